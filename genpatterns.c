@@ -0,0 +1,224 @@
+// Генератор таблиц образцов линий для tictactoe.c. Печатает patterns.h:
+//   gcc -o genpatterns genpatterns.c && ./genpatterns > patterns.h
+// Таблицы получаются при сборке и попадают в программу как константы,
+// поэтому при запуске игры ничего не вычисляется.
+#include <stdio.h>
+#include <stdint.h>
+
+// Линия через клетку — по PATTERN_RADIUS клеток с каждой стороны. Каждая сторона
+// сводится к номеру: клетки до первой блокирующей (камень соперника или край поля) —
+// b штук и камни игрока own среди них дают номер (1 << b) - 1 + own; клетки за
+// блокирующей ни на что не влияют. Таблицы индексируются left * PATTERN_SIDE + right.
+#define PATTERN_RADIUS 5
+#define PATTERN_SIDE ((1 << (PATTERN_RADIUS + 1)) - 1)
+#define PATTERN_CELLS (PATTERN_SIDE * PATTERN_SIDE)
+// Длины рядов, для которых строятся таблицы фигур
+#define PATTERN_MIN_K 3
+#define PATTERN_MAX_K 6
+
+// Клетка линии: пустая, камень игрока или блокирующая
+enum { LINE_EMPTY, LINE_OWN, LINE_BLOCKED };
+
+// Фигуры — те же значения, что у Shape в tictactoe.c
+enum {
+    SHAPE_NONE,
+    SHAPE_TWO,
+    SHAPE_THREE,
+    SHAPE_OPEN_THREE,
+    SHAPE_FOUR,
+    SHAPE_OPEN_FOUR,
+    SHAPE_FIVE,
+};
+
+// Свойства линии для запретов рэндзю — те же значения, что в tictactoe.c
+enum {
+    LINE_FIVE = 1,
+    LINE_OVERLINE = 2,
+    LINE_THREE = 4,
+    LINE_FOURS_SHIFT = 3,
+};
+
+// Раскладка стороны по её номеру: клетки side[0..PATTERN_RADIUS - 1] по удалению от центра
+static void decodePatternSide(int index, int* side) {
+    int open = 0;
+    while (index >= (1 << (open + 1)) - 1) open++;
+    int own = index - ((1 << open) - 1);
+    for (int i = 0; i < PATTERN_RADIUS; i++)
+        side[i] = i < open ? ((own >> i & 1) ? LINE_OWN : LINE_EMPTY) : LINE_BLOCKED;
+}
+
+// Линия с камнем игрока в центре по номерам сторон; 0, если других камней игрока нет
+static int decodeLine(int left, int right, int* line) {
+    int side[PATTERN_RADIUS], own = 0;
+    decodePatternSide(left, side);
+    for (int i = 0; i < PATTERN_RADIUS; i++) {
+        line[PATTERN_RADIUS - 1 - i] = side[i];
+        own |= side[i] == LINE_OWN;
+    }
+    decodePatternSide(right, side);
+    for (int i = 0; i < PATTERN_RADIUS; i++) {
+        line[PATTERN_RADIUS + 1 + i] = side[i];
+        own |= side[i] == LINE_OWN;
+    }
+    line[PATTERN_RADIUS] = LINE_OWN;
+    return own;
+}
+
+// Клетка линии со сдвигом t от центра; за окном — блокирующая
+static int lineAt(const int* line, int t) {
+    return t < -PATTERN_RADIUS || t > PATTERN_RADIUS ? LINE_BLOCKED : line[t + PATTERN_RADIUS];
+}
+
+// Длина ряда камней игрока через центр линии
+static int lineRun(const int* line) {
+    int length = 1;
+    while (lineAt(line, length) == LINE_OWN) length++;
+    for (int t = -1; lineAt(line, t) == LINE_OWN; t--) length++;
+    return length;
+}
+
+// Сколькими разными пустыми клетками линию можно достроить до ряда из k через центр
+static int lineCompletions(int* line, int k) {
+    int count = 0;
+    for (int t = -(k - 1); t <= k - 1; t++) {
+        if (lineAt(line, t) != LINE_EMPTY) continue;
+        line[t + PATTERN_RADIUS] = LINE_OWN;
+        count += lineRun(line) >= k;
+        line[t + PATTERN_RADIUS] = LINE_EMPTY;
+    }
+    return count;
+}
+
+// Фигура линии с камнем игрока в центре; depth — сколько ещё ходов можно перебрать
+static int lineShape(int* line, int k, int depth) {
+    if (lineRun(line) >= k) return SHAPE_FIVE;
+    int completions = lineCompletions(line, k);
+    if (completions) return completions >= 2 ? SHAPE_OPEN_FOUR : SHAPE_FOUR;
+    int best = SHAPE_NONE;
+    for (int t = -PATTERN_RADIUS; t <= PATTERN_RADIUS && depth > 0; t++) {
+        if (lineAt(line, t) != LINE_EMPTY) continue;
+        line[t + PATTERN_RADIUS] = LINE_OWN;
+        int next = lineShape(line, k, depth - 1);
+        line[t + PATTERN_RADIUS] = LINE_EMPTY;
+        int shape = next == SHAPE_OPEN_FOUR ? SHAPE_OPEN_THREE : next == SHAPE_FOUR ? SHAPE_THREE
+                  : next == SHAPE_OPEN_THREE ? SHAPE_TWO : SHAPE_NONE;
+        if (shape > best) best = shape;
+    }
+    return best;
+}
+
+// Есть ли открытая четвёрка через центр: четыре чёрных подряд, и оба конца
+// дают ровно пять
+static int lineHasOpenFour(const int* line) {
+    for (int t = -3; t <= 0; t++) {
+        int four = 1;
+        for (int i = 0; i < 4; i++)
+            four &= lineAt(line, t + i) == LINE_OWN;
+        if (four && lineAt(line, t - 1) == LINE_EMPTY && lineAt(line, t + 4) == LINE_EMPTY &&
+            lineAt(line, t - 2) != LINE_OWN && lineAt(line, t + 5) != LINE_OWN)
+            return 1;
+    }
+    return 0;
+}
+
+// Количество четвёрок через центр: разных наборов из четырёх чёрных камней,
+// которые одним ходом дополняются ровно до пяти
+static int lineFours(const int* line) {
+    int masks[5], count = 0;
+    for (int s = -4; s <= 0; s++) {
+        int blacks = 0, empties = 0, mask = 0;
+        for (int i = 0; i < 5; i++) {
+            int cell = lineAt(line, s + i);
+            if (cell == LINE_OWN) {
+                blacks++;
+                mask |= 1 << (s + i + PATTERN_RADIUS);
+            } else if (cell == LINE_EMPTY) {
+                empties++;
+            }
+        }
+        if (blacks != 4 || empties != 1 || lineAt(line, s - 1) == LINE_OWN || lineAt(line, s + 5) == LINE_OWN)
+            continue;
+        int seen = 0;
+        for (int i = 0; i < count; i++)
+            seen |= masks[i] == mask;
+        if (!seen) masks[count++] = mask;
+    }
+    return count;
+}
+
+// Свойства линии с чёрным камнем в центре
+static int classifyRenjuLine(int* line) {
+    int length = lineRun(line);
+    if (length == 5) return LINE_FIVE;
+    if (length > 5) return LINE_OVERLINE;
+
+    int fours = lineFours(line);
+    if (fours) return (fours > 2 ? 2 : fours) << LINE_FOURS_SHIFT;
+
+    // Открытая тройка: ход в пустую клетку окна даёт открытую четвёрку
+    for (int t = -4; t <= 4; t++) {
+        if (t == 0 || lineAt(line, t) != LINE_EMPTY) continue;
+        line[t + PATTERN_RADIUS] = LINE_OWN;
+        int open = lineHasOpenFour(line);
+        line[t + PATTERN_RADIUS] = LINE_EMPTY;
+        if (open) return LINE_THREE;
+    }
+    return 0;
+}
+
+// Печать массива байтов по 21 числу в строке
+static void printTable(const uint8_t* table, int count, const char* indent) {
+    for (int i = 0; i < count; i++) {
+        if (i % 21 == 0) printf("%s", indent);
+        printf("%d,%s", table[i], i % 21 == 20 || i == count - 1 ? "\n" : " ");
+    }
+}
+
+int main(void) {
+    static uint8_t shapes[PATTERN_MAX_K - PATTERN_MIN_K + 1][PATTERN_CELLS];
+    static uint8_t renju[PATTERN_CELLS];
+    uint8_t reversed[32] = {0};
+
+    for (int i = 0; i < 32; i++)
+        for (int bit = 0; bit < 5; bit++)
+            if (i >> bit & 1) reversed[i] |= 1 << (4 - bit);
+
+    for (int left = 0; left < PATTERN_SIDE; left++) {
+        for (int right = 0; right < PATTERN_SIDE; right++) {
+            int line[2 * PATTERN_RADIUS + 1];
+            int own = decodeLine(left, right, line);
+            // Линия без других камней игрока фигурой не считается: так клетки
+            // вдали от камней остаются без фигур
+            for (int k = PATTERN_MIN_K; k <= PATTERN_MAX_K; k++)
+                shapes[k - PATTERN_MIN_K][left * PATTERN_SIDE + right] = own ? lineShape(line, k, 2) : SHAPE_NONE;
+            renju[left * PATTERN_SIDE + right] = classifyRenjuLine(line);
+        }
+    }
+
+    printf("// Сгенерировано genpatterns.c, не редактировать вручную:\n");
+    printf("//   gcc -o genpatterns genpatterns.c && ./genpatterns > patterns.h\n");
+    printf("#ifndef PATTERNS_H\n#define PATTERNS_H\n\n");
+    printf("#define PATTERN_RADIUS %d\n", PATTERN_RADIUS);
+    printf("#define PATTERN_SIDE ((1 << (PATTERN_RADIUS + 1)) - 1)\n");
+    printf("#define PATTERN_MIN_K %d\n#define PATTERN_MAX_K %d\n\n", PATTERN_MIN_K, PATTERN_MAX_K);
+
+    printf("// Пять младших бит в обратном порядке: левая сторона окна читается от центра\n");
+    printf("static const uint8_t reversed5[32] = {\n");
+    printTable(reversed, 32, "    ");
+    printf("};\n\n");
+
+    printf("// Фигура (Shape) игрока по номерам сторон линии, для каждой длины ряда k\n");
+    printf("static const uint8_t shapePatterns[PATTERN_MAX_K - PATTERN_MIN_K + 1][PATTERN_SIDE * PATTERN_SIDE] = {\n");
+    for (int k = PATTERN_MIN_K; k <= PATTERN_MAX_K; k++) {
+        printf("    { // k = %d\n", k);
+        printTable(shapes[k - PATTERN_MIN_K], PATTERN_CELLS, "        ");
+        printf("    },\n");
+    }
+    printf("};\n\n");
+
+    printf("// Свойства линии для запретов рэндзю после хода чёрных в центр\n");
+    printf("static const uint8_t renjuPatterns[PATTERN_SIDE * PATTERN_SIDE] = {\n");
+    printTable(renju, PATTERN_CELLS, "    ");
+    printf("};\n\n#endif\n");
+    return 0;
+}
@@ -0,0 +1,978 @@
+// Сгенерировано genpatterns.c, не редактировать вручную:
+//   gcc -o genpatterns genpatterns.c && ./genpatterns > patterns.h
+#ifndef PATTERNS_H
+#define PATTERNS_H
+
+#define PATTERN_RADIUS 5
+#define PATTERN_SIDE ((1 << (PATTERN_RADIUS + 1)) - 1)
+#define PATTERN_MIN_K 3
+#define PATTERN_MAX_K 6
+
+// Пять младших бит в обратном порядке: левая сторона окна читается от центра
+static const uint8_t reversed5[32] = {
+    0, 16, 8, 24, 4, 20, 12, 28, 2, 18, 10, 26, 6, 22, 14, 30, 1, 17, 9, 25, 5,
+    21, 13, 29, 3, 19, 11, 27, 7, 23, 15, 31,
+};
+
+// Фигура (Shape) игрока по номерам сторон линии, для каждой длины ряда k
+static const uint8_t shapePatterns[PATTERN_MAX_K - PATTERN_MIN_K + 1][PATTERN_SIDE * PATTERN_SIDE] = {
+    { // k = 3
+        0, 0, 0, 0, 4, 4, 6, 0, 4, 4, 6, 2, 4, 4, 6, 0, 4, 4, 6, 2, 4,
+        4, 6, 2, 4, 4, 6, 2, 4, 4, 6, 0, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4,
+        6, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4, 6,
+        0, 0, 4, 0, 5, 4, 6, 0, 5, 4, 6, 3, 5, 4, 6, 0, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 0, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        0, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6,
+        4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4,
+        6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6,
+        0, 0, 4, 0, 5, 4, 6, 0, 5, 4, 6, 3, 5, 4, 6, 0, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 0, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        4, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        4, 4, 4, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5,
+        5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5,
+        6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        0, 0, 4, 0, 5, 4, 6, 0, 5, 4, 6, 3, 5, 4, 6, 0, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 0, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        4, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        4, 4, 4, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5,
+        5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5,
+        6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        2, 3, 4, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        4, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        4, 4, 4, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5,
+        5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5,
+        6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        0, 0, 4, 0, 5, 4, 6, 0, 5, 4, 6, 3, 5, 4, 6, 0, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 0, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        4, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        4, 4, 4, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5,
+        5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5,
+        6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        2, 3, 4, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        4, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        4, 4, 4, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5,
+        5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5,
+        6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        2, 3, 4, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        4, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        4, 4, 4, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5,
+        5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5,
+        6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        2, 3, 4, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        4, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        4, 4, 4, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5,
+        5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5,
+        6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        0, 0, 4, 0, 5, 4, 6, 0, 5, 4, 6, 3, 5, 4, 6, 0, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 0, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        4, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        4, 4, 4, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5,
+        5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5,
+        6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        2, 3, 4, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        4, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        4, 4, 4, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5,
+        5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5,
+        6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        2, 3, 4, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        4, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        4, 4, 4, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5,
+        5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5,
+        6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        2, 3, 4, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        4, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        4, 4, 4, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5,
+        5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5,
+        6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        2, 3, 4, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        4, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        4, 4, 4, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5,
+        5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5,
+        6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        2, 3, 4, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        4, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        4, 4, 4, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5,
+        5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5,
+        6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        2, 3, 4, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        4, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        4, 4, 4, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5,
+        5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5,
+        6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        2, 3, 4, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        4, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        4, 4, 4, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5,
+        5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5,
+        6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    },
+    { // k = 4
+        0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 4, 2, 4, 4, 6, 0, 2, 2, 4, 2, 4,
+        4, 6, 0, 2, 2, 4, 2, 4, 4, 6, 0, 2, 2, 4, 2, 4, 4, 6, 0, 2, 2,
+        4, 2, 4, 4, 6, 0, 2, 2, 4, 2, 4, 4, 6, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 0, 0, 0, 2, 2, 4, 0, 3, 3, 5, 2, 4, 4, 6, 0, 3, 3, 5, 2, 4,
+        4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 0, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3,
+        5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6,
+        0, 0, 0, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4,
+        4, 6, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4,
+        6, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4, 6,
+        0, 0, 2, 0, 3, 2, 4, 0, 3, 3, 5, 2, 4, 4, 6, 0, 3, 3, 5, 2, 4,
+        4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 0, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3,
+        5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6,
+        0, 2, 4, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        0, 2, 4, 2, 4, 2, 4, 2, 4, 3, 5, 3, 5, 4, 6, 2, 4, 3, 5, 3, 5,
+        4, 6, 2, 4, 3, 5, 3, 5, 4, 6, 2, 4, 3, 5, 3, 5, 4, 6, 2, 4, 3,
+        5, 3, 5, 4, 6, 2, 4, 3, 5, 3, 5, 4, 6, 2, 4, 3, 5, 3, 5, 4, 6,
+        0, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6,
+        4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4,
+        6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6,
+        0, 0, 2, 0, 3, 2, 4, 0, 3, 3, 5, 2, 4, 4, 6, 0, 3, 3, 5, 2, 4,
+        4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 0, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3,
+        5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6,
+        2, 3, 4, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        2, 3, 4, 3, 4, 3, 4, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5,
+        4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3,
+        5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6,
+        4, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        2, 2, 2, 2, 3, 3, 4, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4,
+        4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3,
+        5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6,
+        4, 4, 4, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5,
+        5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5,
+        6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5,
+        5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4,
+        5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        0, 0, 2, 0, 3, 2, 4, 0, 3, 3, 5, 2, 4, 4, 6, 0, 3, 3, 5, 2, 4,
+        4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 0, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3,
+        5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6,
+        2, 3, 4, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        2, 3, 4, 3, 4, 3, 4, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5,
+        4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3,
+        5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6,
+        4, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        2, 2, 2, 2, 3, 3, 4, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4,
+        4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3,
+        5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6,
+        4, 4, 4, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5,
+        5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5,
+        6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5,
+        5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4,
+        5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        0, 1, 2, 1, 3, 2, 4, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4,
+        4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3,
+        5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6,
+        2, 3, 4, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        2, 3, 4, 3, 4, 3, 4, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5,
+        4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3,
+        5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6,
+        4, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        2, 2, 2, 2, 3, 3, 4, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4,
+        4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3,
+        5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6,
+        4, 4, 4, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5,
+        5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5,
+        6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5,
+        5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4,
+        5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        0, 0, 2, 0, 3, 2, 4, 0, 3, 3, 5, 2, 4, 4, 6, 0, 3, 3, 5, 2, 4,
+        4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 0, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3,
+        5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6,
+        2, 3, 4, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        2, 3, 4, 3, 4, 3, 4, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5,
+        4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3,
+        5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6,
+        4, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        2, 2, 2, 2, 3, 3, 4, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4,
+        4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3,
+        5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6,
+        4, 4, 4, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5,
+        5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5,
+        6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5,
+        5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4,
+        5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        0, 1, 2, 1, 3, 2, 4, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4,
+        4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3,
+        5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6,
+        2, 3, 4, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        2, 3, 4, 3, 4, 3, 4, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5,
+        4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3,
+        5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6,
+        4, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        2, 2, 2, 2, 3, 3, 4, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4,
+        4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3,
+        5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6,
+        4, 4, 4, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5,
+        5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5,
+        6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5,
+        5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4,
+        5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        0, 1, 2, 1, 3, 2, 4, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4,
+        4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3,
+        5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6,
+        2, 3, 4, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        2, 3, 4, 3, 4, 3, 4, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5,
+        4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3,
+        5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6,
+        4, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        2, 2, 2, 2, 3, 3, 4, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4,
+        4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3,
+        5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6,
+        4, 4, 4, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5,
+        5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5,
+        6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5,
+        5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4,
+        5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        0, 1, 2, 1, 3, 2, 4, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4,
+        4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3,
+        5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6,
+        2, 3, 4, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        2, 3, 4, 3, 4, 3, 4, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5,
+        4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3,
+        5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6,
+        4, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        2, 2, 2, 2, 3, 3, 4, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4,
+        4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3,
+        5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6,
+        4, 4, 4, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5,
+        5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5,
+        6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5,
+        5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4,
+        5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    },
+    { // k = 5
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2,
+        2, 4, 0, 2, 2, 4, 2, 4, 4, 6, 0, 0, 0, 2, 0, 2, 2, 4, 0, 2, 2,
+        4, 2, 4, 4, 6, 0, 0, 0, 2, 0, 2, 2, 4, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 2, 4, 0, 1, 1, 3, 1, 3,
+        3, 5, 0, 2, 2, 4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2,
+        4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 4, 2, 4, 4, 6, 0, 2, 2, 4, 2, 4,
+        4, 6, 0, 2, 2, 4, 2, 4, 4, 6, 0, 2, 2, 4, 2, 4, 4, 6, 0, 2, 2,
+        4, 2, 4, 4, 6, 0, 2, 2, 4, 2, 4, 4, 6, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 0, 0, 0, 0, 0, 2, 0, 1, 1, 3, 0, 2, 2, 4, 0, 1, 1, 3, 1, 3,
+        3, 5, 0, 2, 2, 4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2,
+        4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 0, 0, 0, 2, 2, 4, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4,
+        4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3,
+        5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6,
+        0, 0, 0, 0, 2, 2, 4, 0, 2, 2, 4, 0, 2, 2, 4, 0, 2, 2, 4, 1, 3,
+        3, 5, 1, 3, 3, 5, 2, 4, 4, 6, 0, 2, 2, 4, 1, 3, 3, 5, 1, 3, 3,
+        5, 2, 4, 4, 6, 0, 2, 2, 4, 1, 3, 3, 5, 1, 3, 3, 5, 2, 4, 4, 6,
+        0, 0, 0, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4,
+        4, 6, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4,
+        6, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4, 6,
+        0, 0, 0, 0, 1, 0, 2, 0, 1, 1, 3, 0, 2, 2, 4, 0, 1, 1, 3, 1, 3,
+        3, 5, 0, 2, 2, 4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2,
+        4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 0, 2, 1, 3, 2, 4, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4,
+        4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3,
+        5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6,
+        0, 0, 2, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3,
+        3, 5, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 2, 4, 1, 3, 3, 5, 1, 3, 3,
+        5, 2, 4, 4, 6, 1, 3, 2, 4, 1, 3, 3, 5, 1, 3, 3, 5, 2, 4, 4, 6,
+        0, 2, 4, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        0, 0, 2, 0, 2, 0, 2, 0, 2, 1, 3, 1, 3, 2, 4, 0, 2, 1, 3, 1, 3,
+        3, 5, 0, 2, 2, 4, 2, 4, 4, 6, 0, 2, 1, 3, 1, 3, 3, 5, 0, 2, 2,
+        4, 2, 4, 4, 6, 0, 2, 1, 3, 1, 3, 3, 5, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 2, 4, 2, 4, 2, 4, 2, 4, 3, 5, 3, 5, 4, 6, 2, 4, 3, 5, 3, 5,
+        4, 6, 2, 4, 3, 5, 3, 5, 4, 6, 2, 4, 3, 5, 3, 5, 4, 6, 2, 4, 3,
+        5, 3, 5, 4, 6, 2, 4, 3, 5, 3, 5, 4, 6, 2, 4, 3, 5, 3, 5, 4, 6,
+        0, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4,
+        3, 5, 2, 4, 3, 5, 3, 5, 4, 6, 2, 4, 2, 4, 2, 4, 3, 5, 2, 4, 3,
+        5, 3, 5, 4, 6, 2, 4, 2, 4, 2, 4, 3, 5, 2, 4, 3, 5, 3, 5, 4, 6,
+        0, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6,
+        4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4,
+        6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6,
+        0, 0, 0, 0, 1, 0, 2, 0, 1, 1, 3, 0, 2, 2, 4, 0, 1, 1, 3, 1, 3,
+        3, 5, 0, 2, 2, 4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2,
+        4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 1, 2, 1, 3, 2, 4, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4,
+        4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3,
+        5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6,
+        0, 1, 2, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3,
+        3, 5, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 2, 4, 1, 3, 3, 5, 1, 3, 3,
+        5, 2, 4, 4, 6, 1, 3, 2, 4, 1, 3, 3, 5, 1, 3, 3, 5, 2, 4, 4, 6,
+        2, 3, 4, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        0, 1, 2, 1, 2, 1, 2, 1, 2, 1, 3, 1, 3, 2, 4, 1, 2, 1, 3, 1, 3,
+        3, 5, 1, 2, 2, 4, 2, 4, 4, 6, 1, 2, 1, 3, 1, 3, 3, 5, 1, 2, 2,
+        4, 2, 4, 4, 6, 1, 2, 1, 3, 1, 3, 3, 5, 1, 2, 2, 4, 2, 4, 4, 6,
+        2, 3, 4, 3, 4, 3, 4, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5,
+        4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3,
+        5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6,
+        2, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4,
+        3, 5, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 4, 3, 4, 3, 5, 3, 4, 3,
+        5, 3, 5, 4, 6, 3, 4, 3, 4, 3, 4, 3, 5, 3, 4, 3, 5, 3, 5, 4, 6,
+        4, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        0, 0, 0, 0, 1, 1, 2, 0, 1, 1, 3, 0, 2, 2, 4, 0, 1, 1, 3, 1, 3,
+        3, 5, 0, 2, 2, 4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2,
+        4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2, 4, 2, 4, 4, 6,
+        2, 2, 2, 2, 3, 3, 4, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4,
+        4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3,
+        5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6,
+        2, 2, 2, 2, 3, 3, 4, 2, 3, 3, 4, 2, 3, 3, 4, 2, 3, 3, 4, 2, 3,
+        3, 5, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 4, 2, 3, 3, 5, 2, 3, 3,
+        5, 2, 4, 4, 6, 2, 3, 3, 4, 2, 3, 3, 5, 2, 3, 3, 5, 2, 4, 4, 6,
+        4, 4, 4, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5,
+        5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5,
+        6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3, 3, 4, 2, 2, 2, 3, 2, 3,
+        3, 5, 2, 2, 2, 4, 2, 4, 4, 6, 2, 2, 2, 3, 2, 3, 3, 5, 2, 2, 2,
+        4, 2, 4, 4, 6, 2, 2, 2, 3, 2, 3, 3, 5, 2, 2, 2, 4, 2, 4, 4, 6,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5,
+        5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4,
+        5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 5, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 4, 4, 4, 4, 5, 4, 4, 4,
+        5, 4, 5, 5, 6, 4, 4, 4, 4, 4, 4, 4, 5, 4, 4, 4, 5, 4, 5, 5, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        0, 0, 0, 0, 1, 0, 2, 0, 1, 1, 3, 0, 2, 2, 4, 0, 1, 1, 3, 1, 3,
+        3, 5, 0, 2, 2, 4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2,
+        4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 1, 2, 1, 3, 2, 4, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4,
+        4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3,
+        5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6,
+        0, 1, 2, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3,
+        3, 5, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 2, 4, 1, 3, 3, 5, 1, 3, 3,
+        5, 2, 4, 4, 6, 1, 3, 2, 4, 1, 3, 3, 5, 1, 3, 3, 5, 2, 4, 4, 6,
+        2, 3, 4, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        0, 1, 2, 1, 2, 1, 2, 1, 2, 1, 3, 1, 3, 2, 4, 1, 2, 1, 3, 1, 3,
+        3, 5, 1, 2, 2, 4, 2, 4, 4, 6, 1, 2, 1, 3, 1, 3, 3, 5, 1, 2, 2,
+        4, 2, 4, 4, 6, 1, 2, 1, 3, 1, 3, 3, 5, 1, 2, 2, 4, 2, 4, 4, 6,
+        2, 3, 4, 3, 4, 3, 4, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5,
+        4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3,
+        5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6,
+        2, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4,
+        3, 5, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 4, 3, 4, 3, 5, 3, 4, 3,
+        5, 3, 5, 4, 6, 3, 4, 3, 4, 3, 4, 3, 5, 3, 4, 3, 5, 3, 5, 4, 6,
+        4, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        0, 0, 0, 0, 1, 1, 2, 0, 1, 1, 3, 0, 2, 2, 4, 0, 1, 1, 3, 1, 3,
+        3, 5, 0, 2, 2, 4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2,
+        4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2, 4, 2, 4, 4, 6,
+        2, 2, 2, 2, 3, 3, 4, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4,
+        4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3,
+        5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6,
+        2, 2, 2, 2, 3, 3, 4, 2, 3, 3, 4, 2, 3, 3, 4, 2, 3, 3, 4, 2, 3,
+        3, 5, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 4, 2, 3, 3, 5, 2, 3, 3,
+        5, 2, 4, 4, 6, 2, 3, 3, 4, 2, 3, 3, 5, 2, 3, 3, 5, 2, 4, 4, 6,
+        4, 4, 4, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5,
+        5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5,
+        6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3, 3, 4, 2, 2, 2, 3, 2, 3,
+        3, 5, 2, 2, 2, 4, 2, 4, 4, 6, 2, 2, 2, 3, 2, 3, 3, 5, 2, 2, 2,
+        4, 2, 4, 4, 6, 2, 2, 2, 3, 2, 3, 3, 5, 2, 2, 2, 4, 2, 4, 4, 6,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5,
+        5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4,
+        5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 5, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 4, 4, 4, 4, 5, 4, 4, 4,
+        5, 4, 5, 5, 6, 4, 4, 4, 4, 4, 4, 4, 5, 4, 4, 4, 5, 4, 5, 5, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        0, 0, 0, 0, 1, 0, 2, 0, 1, 1, 3, 0, 2, 2, 4, 0, 1, 1, 3, 1, 3,
+        3, 5, 0, 2, 2, 4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2,
+        4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 1, 2, 1, 3, 2, 4, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4,
+        4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3,
+        5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6,
+        0, 1, 2, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3,
+        3, 5, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 2, 4, 1, 3, 3, 5, 1, 3, 3,
+        5, 2, 4, 4, 6, 1, 3, 2, 4, 1, 3, 3, 5, 1, 3, 3, 5, 2, 4, 4, 6,
+        2, 3, 4, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        0, 1, 2, 1, 2, 1, 2, 1, 2, 1, 3, 1, 3, 2, 4, 1, 2, 1, 3, 1, 3,
+        3, 5, 1, 2, 2, 4, 2, 4, 4, 6, 1, 2, 1, 3, 1, 3, 3, 5, 1, 2, 2,
+        4, 2, 4, 4, 6, 1, 2, 1, 3, 1, 3, 3, 5, 1, 2, 2, 4, 2, 4, 4, 6,
+        2, 3, 4, 3, 4, 3, 4, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5,
+        4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3,
+        5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6,
+        2, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4,
+        3, 5, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 4, 3, 4, 3, 5, 3, 4, 3,
+        5, 3, 5, 4, 6, 3, 4, 3, 4, 3, 4, 3, 5, 3, 4, 3, 5, 3, 5, 4, 6,
+        4, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        0, 0, 0, 0, 1, 1, 2, 0, 1, 1, 3, 0, 2, 2, 4, 0, 1, 1, 3, 1, 3,
+        3, 5, 0, 2, 2, 4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2,
+        4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2, 4, 2, 4, 4, 6,
+        2, 2, 2, 2, 3, 3, 4, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4,
+        4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3,
+        5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6,
+        2, 2, 2, 2, 3, 3, 4, 2, 3, 3, 4, 2, 3, 3, 4, 2, 3, 3, 4, 2, 3,
+        3, 5, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 4, 2, 3, 3, 5, 2, 3, 3,
+        5, 2, 4, 4, 6, 2, 3, 3, 4, 2, 3, 3, 5, 2, 3, 3, 5, 2, 4, 4, 6,
+        4, 4, 4, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5,
+        5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5,
+        6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3, 3, 4, 2, 2, 2, 3, 2, 3,
+        3, 5, 2, 2, 2, 4, 2, 4, 4, 6, 2, 2, 2, 3, 2, 3, 3, 5, 2, 2, 2,
+        4, 2, 4, 4, 6, 2, 2, 2, 3, 2, 3, 3, 5, 2, 2, 2, 4, 2, 4, 4, 6,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5,
+        5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4,
+        5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 5, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 4, 4, 4, 4, 5, 4, 4, 4,
+        5, 4, 5, 5, 6, 4, 4, 4, 4, 4, 4, 4, 5, 4, 4, 4, 5, 4, 5, 5, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    },
+    { // k = 6
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+        2, 0, 2, 2, 4, 0, 0, 0, 2, 0, 2, 2, 4, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 2, 0, 0, 0, 2, 0, 2, 2, 4, 0, 0, 0, 1, 0, 1, 1, 3, 0, 1, 1,
+        3, 1, 3, 3, 5, 0, 0, 0, 2, 0, 2, 2, 4, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2,
+        2, 4, 0, 2, 2, 4, 2, 4, 4, 6, 0, 0, 0, 2, 0, 2, 2, 4, 0, 2, 2,
+        4, 2, 4, 4, 6, 0, 0, 0, 2, 0, 2, 2, 4, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 1,
+        1, 3, 0, 0, 0, 2, 0, 2, 2, 4, 0, 0, 0, 1, 0, 1, 1, 3, 0, 1, 1,
+        3, 1, 3, 3, 5, 0, 0, 0, 2, 0, 2, 2, 4, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 2, 4, 0, 1, 1, 3, 1, 3,
+        3, 5, 0, 2, 2, 4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2,
+        4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 2, 4, 0, 0, 0, 2, 0, 2,
+        2, 4, 0, 0, 0, 2, 0, 2, 2, 4, 0, 0, 0, 2, 0, 2, 2, 4, 0, 1, 1,
+        3, 1, 3, 3, 5, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 4, 2, 4, 4, 6, 0, 2, 2, 4, 2, 4,
+        4, 6, 0, 2, 2, 4, 2, 4, 4, 6, 0, 2, 2, 4, 2, 4, 4, 6, 0, 2, 2,
+        4, 2, 4, 4, 6, 0, 2, 2, 4, 2, 4, 4, 6, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 1, 0, 1,
+        1, 3, 0, 0, 0, 2, 0, 2, 2, 4, 0, 0, 0, 1, 0, 1, 1, 3, 0, 1, 1,
+        3, 1, 3, 3, 5, 0, 0, 0, 2, 0, 2, 2, 4, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 0, 0, 0, 0, 0, 2, 0, 1, 1, 3, 0, 2, 2, 4, 0, 1, 1, 3, 1, 3,
+        3, 5, 0, 2, 2, 4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2,
+        4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 0, 0, 0, 0, 0, 2, 0, 1, 1, 3, 0, 2, 2, 4, 0, 1, 1, 3, 0, 2,
+        2, 4, 0, 1, 1, 3, 0, 2, 2, 4, 0, 1, 1, 3, 0, 2, 2, 4, 0, 1, 1,
+        3, 1, 3, 3, 5, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 0, 0, 0, 2, 2, 4, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4,
+        4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3,
+        5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6,
+        0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 2, 0, 1,
+        1, 3, 0, 1, 1, 3, 0, 2, 2, 4, 0, 0, 0, 2, 0, 1, 1, 3, 0, 1, 1,
+        3, 1, 3, 3, 5, 0, 0, 0, 2, 0, 2, 2, 4, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 0, 0, 0, 2, 2, 4, 0, 2, 2, 4, 0, 2, 2, 4, 0, 2, 2, 4, 1, 3,
+        3, 5, 1, 3, 3, 5, 2, 4, 4, 6, 0, 2, 2, 4, 1, 3, 3, 5, 1, 3, 3,
+        5, 2, 4, 4, 6, 0, 2, 2, 4, 1, 3, 3, 5, 1, 3, 3, 5, 2, 4, 4, 6,
+        0, 0, 0, 0, 2, 2, 4, 0, 2, 2, 4, 0, 2, 2, 4, 0, 2, 2, 4, 0, 2,
+        2, 4, 0, 2, 2, 4, 0, 2, 2, 4, 0, 2, 2, 4, 0, 2, 2, 4, 0, 2, 2,
+        4, 1, 3, 3, 5, 0, 2, 2, 4, 1, 3, 3, 5, 1, 3, 3, 5, 2, 4, 4, 6,
+        0, 0, 0, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4,
+        4, 6, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4,
+        6, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4, 6, 2, 4, 4, 6,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 1, 0, 1,
+        1, 3, 0, 0, 0, 2, 0, 2, 2, 4, 0, 0, 0, 1, 0, 1, 1, 3, 0, 1, 1,
+        3, 1, 3, 3, 5, 0, 0, 0, 2, 0, 2, 2, 4, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 0, 0, 0, 1, 0, 2, 0, 1, 1, 3, 0, 2, 2, 4, 0, 1, 1, 3, 1, 3,
+        3, 5, 0, 2, 2, 4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2,
+        4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 0, 0, 0, 1, 0, 2, 0, 1, 1, 3, 0, 2, 2, 4, 0, 1, 1, 3, 0, 2,
+        2, 4, 0, 1, 1, 3, 0, 2, 2, 4, 0, 1, 1, 3, 0, 2, 2, 4, 0, 1, 1,
+        3, 1, 3, 3, 5, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 0, 2, 1, 3, 2, 4, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4,
+        4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3,
+        5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6,
+        0, 0, 0, 0, 1, 0, 2, 0, 1, 0, 2, 0, 1, 0, 2, 0, 1, 0, 2, 0, 1,
+        1, 3, 0, 1, 1, 3, 0, 2, 2, 4, 0, 1, 0, 2, 0, 1, 1, 3, 0, 1, 1,
+        3, 1, 3, 3, 5, 0, 1, 0, 2, 0, 2, 2, 4, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 0, 2, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3,
+        3, 5, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 2, 4, 1, 3, 3, 5, 1, 3, 3,
+        5, 2, 4, 4, 6, 1, 3, 2, 4, 1, 3, 3, 5, 1, 3, 3, 5, 2, 4, 4, 6,
+        0, 0, 2, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3,
+        2, 4, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3, 2,
+        4, 1, 3, 3, 5, 1, 3, 2, 4, 1, 3, 3, 5, 1, 3, 3, 5, 2, 4, 4, 6,
+        0, 2, 4, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 2, 0, 0, 0, 1, 0, 1,
+        1, 3, 0, 0, 0, 2, 0, 2, 2, 4, 0, 0, 0, 1, 0, 1, 1, 3, 0, 1, 1,
+        3, 1, 3, 3, 5, 0, 0, 0, 2, 0, 2, 2, 4, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 0, 2, 0, 2, 0, 2, 0, 2, 1, 3, 1, 3, 2, 4, 0, 2, 1, 3, 1, 3,
+        3, 5, 0, 2, 2, 4, 2, 4, 4, 6, 0, 2, 1, 3, 1, 3, 3, 5, 0, 2, 2,
+        4, 2, 4, 4, 6, 0, 2, 1, 3, 1, 3, 3, 5, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 0, 2, 0, 2, 0, 2, 0, 2, 1, 3, 1, 3, 2, 4, 0, 2, 1, 3, 1, 3,
+        2, 4, 0, 2, 1, 3, 1, 3, 2, 4, 0, 2, 1, 3, 1, 3, 2, 4, 0, 2, 1,
+        3, 1, 3, 3, 5, 0, 2, 1, 3, 1, 3, 3, 5, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 2, 4, 2, 4, 2, 4, 2, 4, 3, 5, 3, 5, 4, 6, 2, 4, 3, 5, 3, 5,
+        4, 6, 2, 4, 3, 5, 3, 5, 4, 6, 2, 4, 3, 5, 3, 5, 4, 6, 2, 4, 3,
+        5, 3, 5, 4, 6, 2, 4, 3, 5, 3, 5, 4, 6, 2, 4, 3, 5, 3, 5, 4, 6,
+        0, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+        1, 3, 0, 2, 1, 3, 1, 3, 2, 4, 0, 2, 0, 2, 0, 2, 1, 3, 0, 2, 1,
+        3, 1, 3, 3, 5, 0, 2, 0, 2, 0, 2, 2, 4, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4,
+        3, 5, 2, 4, 3, 5, 3, 5, 4, 6, 2, 4, 2, 4, 2, 4, 3, 5, 2, 4, 3,
+        5, 3, 5, 4, 6, 2, 4, 2, 4, 2, 4, 3, 5, 2, 4, 3, 5, 3, 5, 4, 6,
+        0, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4,
+        2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2, 4, 2,
+        4, 2, 4, 3, 5, 2, 4, 2, 4, 2, 4, 3, 5, 2, 4, 3, 5, 3, 5, 4, 6,
+        0, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6,
+        4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4,
+        6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6, 4, 6,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 1, 0, 1,
+        1, 3, 0, 0, 0, 2, 0, 2, 2, 4, 0, 0, 0, 1, 0, 1, 1, 3, 0, 1, 1,
+        3, 1, 3, 3, 5, 0, 0, 0, 2, 0, 2, 2, 4, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 0, 0, 0, 1, 0, 2, 0, 1, 1, 3, 0, 2, 2, 4, 0, 1, 1, 3, 1, 3,
+        3, 5, 0, 2, 2, 4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2,
+        4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 0, 0, 0, 1, 0, 2, 0, 1, 1, 3, 0, 2, 2, 4, 0, 1, 1, 3, 0, 2,
+        2, 4, 0, 1, 1, 3, 0, 2, 2, 4, 0, 1, 1, 3, 0, 2, 2, 4, 0, 1, 1,
+        3, 1, 3, 3, 5, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 1, 2, 1, 3, 2, 4, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4,
+        4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3,
+        5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 3, 5, 2, 4, 4, 6,
+        0, 0, 0, 0, 1, 0, 2, 0, 1, 0, 2, 0, 1, 0, 2, 0, 1, 0, 2, 0, 1,
+        1, 3, 0, 1, 1, 3, 0, 2, 2, 4, 0, 1, 0, 2, 0, 1, 1, 3, 0, 1, 1,
+        3, 1, 3, 3, 5, 0, 1, 0, 2, 0, 2, 2, 4, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 1, 2, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3,
+        3, 5, 1, 3, 3, 5, 2, 4, 4, 6, 1, 3, 2, 4, 1, 3, 3, 5, 1, 3, 3,
+        5, 2, 4, 4, 6, 1, 3, 2, 4, 1, 3, 3, 5, 1, 3, 3, 5, 2, 4, 4, 6,
+        0, 1, 2, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3,
+        2, 4, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3, 2, 4, 1, 3, 2,
+        4, 1, 3, 3, 5, 1, 3, 2, 4, 1, 3, 3, 5, 1, 3, 3, 5, 2, 4, 4, 6,
+        2, 3, 4, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5,
+        4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4,
+        6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6, 3, 5, 4, 6,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 2, 0, 0, 0, 1, 0, 1,
+        1, 3, 0, 0, 0, 2, 0, 2, 2, 4, 0, 0, 0, 1, 0, 1, 1, 3, 0, 1, 1,
+        3, 1, 3, 3, 5, 0, 0, 0, 2, 0, 2, 2, 4, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 1, 2, 1, 2, 1, 2, 1, 2, 1, 3, 1, 3, 2, 4, 1, 2, 1, 3, 1, 3,
+        3, 5, 1, 2, 2, 4, 2, 4, 4, 6, 1, 2, 1, 3, 1, 3, 3, 5, 1, 2, 2,
+        4, 2, 4, 4, 6, 1, 2, 1, 3, 1, 3, 3, 5, 1, 2, 2, 4, 2, 4, 4, 6,
+        0, 1, 2, 1, 2, 1, 2, 1, 2, 1, 3, 1, 3, 2, 4, 1, 2, 1, 3, 1, 3,
+        2, 4, 1, 2, 1, 3, 1, 3, 2, 4, 1, 2, 1, 3, 1, 3, 2, 4, 1, 2, 1,
+        3, 1, 3, 3, 5, 1, 2, 1, 3, 1, 3, 3, 5, 1, 2, 2, 4, 2, 4, 4, 6,
+        2, 3, 4, 3, 4, 3, 4, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5,
+        4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3,
+        5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 5, 3, 5, 4, 6,
+        0, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+        1, 3, 1, 2, 1, 3, 1, 3, 2, 4, 1, 2, 1, 2, 1, 2, 1, 3, 1, 2, 1,
+        3, 1, 3, 3, 5, 1, 2, 1, 2, 1, 2, 2, 4, 1, 2, 2, 4, 2, 4, 4, 6,
+        2, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4,
+        3, 5, 3, 4, 3, 5, 3, 5, 4, 6, 3, 4, 3, 4, 3, 4, 3, 5, 3, 4, 3,
+        5, 3, 5, 4, 6, 3, 4, 3, 4, 3, 4, 3, 5, 3, 4, 3, 5, 3, 5, 4, 6,
+        2, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4,
+        3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+        4, 3, 4, 3, 5, 3, 4, 3, 4, 3, 4, 3, 5, 3, 4, 3, 5, 3, 5, 4, 6,
+        4, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6, 5, 6,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 1, 0, 1,
+        1, 3, 0, 0, 0, 2, 0, 2, 2, 4, 0, 0, 0, 1, 0, 1, 1, 3, 0, 1, 1,
+        3, 1, 3, 3, 5, 0, 0, 0, 2, 0, 2, 2, 4, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 0, 0, 0, 1, 1, 2, 0, 1, 1, 3, 0, 2, 2, 4, 0, 1, 1, 3, 1, 3,
+        3, 5, 0, 2, 2, 4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2,
+        4, 2, 4, 4, 6, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2, 4, 2, 4, 4, 6,
+        0, 0, 0, 0, 1, 1, 2, 0, 1, 1, 3, 0, 2, 2, 4, 0, 1, 1, 3, 0, 2,
+        2, 4, 0, 1, 1, 3, 0, 2, 2, 4, 0, 1, 1, 3, 0, 2, 2, 4, 0, 1, 1,
+        3, 1, 3, 3, 5, 0, 1, 1, 3, 1, 3, 3, 5, 0, 2, 2, 4, 2, 4, 4, 6,
+        2, 2, 2, 2, 3, 3, 4, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4,
+        4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3,
+        5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 5, 2, 4, 4, 6,
+        0, 0, 0, 0, 1, 1, 2, 0, 1, 1, 2, 0, 1, 1, 2, 0, 1, 1, 2, 0, 1,
+        1, 3, 0, 1, 1, 3, 0, 2, 2, 4, 0, 1, 1, 2, 0, 1, 1, 3, 0, 1, 1,
+        3, 1, 3, 3, 5, 0, 1, 1, 2, 0, 2, 2, 4, 0, 2, 2, 4, 2, 4, 4, 6,
+        2, 2, 2, 2, 3, 3, 4, 2, 3, 3, 4, 2, 3, 3, 4, 2, 3, 3, 4, 2, 3,
+        3, 5, 2, 3, 3, 5, 2, 4, 4, 6, 2, 3, 3, 4, 2, 3, 3, 5, 2, 3, 3,
+        5, 2, 4, 4, 6, 2, 3, 3, 4, 2, 3, 3, 5, 2, 3, 3, 5, 2, 4, 4, 6,
+        2, 2, 2, 2, 3, 3, 4, 2, 3, 3, 4, 2, 3, 3, 4, 2, 3, 3, 4, 2, 3,
+        3, 4, 2, 3, 3, 4, 2, 3, 3, 4, 2, 3, 3, 4, 2, 3, 3, 4, 2, 3, 3,
+        4, 2, 3, 3, 5, 2, 3, 3, 4, 2, 3, 3, 5, 2, 3, 3, 5, 2, 4, 4, 6,
+        4, 4, 4, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5,
+        5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5,
+        6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6, 4, 5, 5, 6,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 2, 0, 0, 0, 1, 0, 1,
+        1, 3, 0, 0, 0, 2, 0, 2, 2, 4, 0, 0, 0, 1, 0, 1, 1, 3, 0, 1, 1,
+        3, 1, 3, 3, 5, 0, 0, 0, 2, 0, 2, 2, 4, 0, 2, 2, 4, 2, 4, 4, 6,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3, 3, 4, 2, 2, 2, 3, 2, 3,
+        3, 5, 2, 2, 2, 4, 2, 4, 4, 6, 2, 2, 2, 3, 2, 3, 3, 5, 2, 2, 2,
+        4, 2, 4, 4, 6, 2, 2, 2, 3, 2, 3, 3, 5, 2, 2, 2, 4, 2, 4, 4, 6,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 3, 3, 4, 2, 2, 2, 3, 2, 3,
+        3, 4, 2, 2, 2, 3, 2, 3, 3, 4, 2, 2, 2, 3, 2, 3, 3, 4, 2, 2, 2,
+        3, 2, 3, 3, 5, 2, 2, 2, 3, 2, 3, 3, 5, 2, 2, 2, 4, 2, 4, 4, 6,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5,
+        5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4,
+        5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 5, 4, 5, 5, 6,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 3, 2, 2, 2, 3, 2, 3, 3, 4, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2,
+        3, 2, 3, 3, 5, 2, 2, 2, 2, 2, 2, 2, 4, 2, 2, 2, 4, 2, 4, 4, 6,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 5, 4, 4, 4, 5, 4, 5, 5, 6, 4, 4, 4, 4, 4, 4, 4, 5, 4, 4, 4,
+        5, 4, 5, 5, 6, 4, 4, 4, 4, 4, 4, 4, 5, 4, 4, 4, 5, 4, 5, 5, 6,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 5, 4, 4, 4, 4, 4, 4, 4, 5, 4, 4, 4, 5, 4, 5, 5, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    },
+};
+
+// Свойства линии для запретов рэндзю после хода чёрных в центр
+static const uint8_t renjuPatterns[PATTERN_SIDE * PATTERN_SIDE] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 8, 0, 0, 0, 8, 0, 8, 8, 1, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0,
+    8, 0, 8, 8, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 4, 0, 4,
+    4, 8, 0, 0, 0, 8, 0, 8, 8, 1, 0, 0, 0, 4, 0, 4, 4, 8, 0, 0, 0,
+    8, 0, 8, 8, 1, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 8, 8, 1, 0, 0, 0, 8, 0, 8,
+    8, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 8, 0, 8, 8, 1, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 8, 0, 8, 8, 1, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 8, 0, 0, 0, 4, 0, 4,
+    4, 8, 0, 0, 0, 8, 0, 8, 8, 1, 0, 0, 0, 4, 0, 4, 4, 8, 0, 0, 0,
+    8, 0, 8, 8, 1, 0, 0, 0, 4, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 8, 0, 4, 4, 8, 0, 8, 8, 1, 0, 4, 4, 8, 0, 8,
+    8, 1, 0, 0, 0, 8, 0, 0, 0, 2, 0, 4, 4, 8, 0, 8, 8, 1, 0, 0, 0,
+    8, 0, 0, 0, 2, 0, 4, 4, 8, 0, 8, 8, 1, 0, 0, 0, 8, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0,
+    0, 8, 0, 0, 0, 16, 0, 8, 8, 1, 0, 0, 0, 8, 0, 0, 0, 8, 0, 0, 0,
+    16, 0, 8, 8, 1, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 2,
+    0, 0, 0, 0, 8, 8, 1, 0, 8, 8, 1, 0, 0, 0, 2, 0, 8, 8, 1, 0, 0,
+    0, 2, 0, 8, 8, 1, 0, 0, 0, 2, 0, 8, 8, 1, 0, 0, 0, 2, 0, 8, 8,
+    1, 0, 0, 0, 2, 0, 8, 8, 1, 0, 0, 0, 2, 0, 8, 8, 1, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 8, 0, 0, 0, 4, 0, 4,
+    4, 8, 0, 0, 0, 8, 0, 8, 8, 1, 0, 0, 0, 4, 0, 4, 4, 8, 0, 0, 0,
+    8, 0, 8, 8, 1, 0, 0, 0, 4, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 4, 0, 8, 0, 4, 4, 8, 0, 8, 8, 1, 0, 4, 4, 8, 0, 8,
+    8, 1, 0, 4, 0, 8, 0, 0, 0, 2, 0, 4, 4, 8, 0, 8, 8, 1, 0, 4, 0,
+    8, 0, 0, 0, 2, 0, 4, 4, 8, 0, 8, 8, 1, 0, 4, 0, 8, 0, 0, 0, 2,
+    0, 0, 0, 0, 4, 0, 8, 0, 4, 0, 8, 0, 0, 0, 0, 0, 4, 0, 8, 0, 0,
+    0, 8, 0, 4, 0, 16, 0, 8, 8, 1, 0, 4, 0, 8, 0, 0, 0, 8, 0, 4, 0,
+    16, 0, 8, 8, 1, 0, 4, 0, 8, 0, 0, 0, 0, 0, 4, 0, 8, 0, 0, 0, 2,
+    0, 0, 8, 4, 8, 8, 1, 4, 8, 8, 1, 0, 8, 0, 2, 4, 8, 8, 1, 0, 8,
+    0, 2, 4, 8, 8, 1, 0, 8, 0, 2, 4, 8, 8, 1, 0, 8, 0, 2, 4, 8, 8,
+    1, 0, 8, 0, 2, 4, 8, 8, 1, 0, 8, 0, 2, 4, 8, 8, 1, 0, 8, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 4, 0, 4,
+    4, 8, 0, 0, 0, 8, 0, 8, 8, 1, 0, 0, 0, 4, 0, 4, 4, 8, 0, 0, 0,
+    8, 0, 8, 8, 1, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 8, 0, 8, 0, 0, 0, 8, 0, 8, 0, 16, 8, 1, 0, 8, 0, 8, 0, 16,
+    8, 1, 0, 8, 0, 0, 0, 8, 0, 2, 0, 8, 0, 8, 0, 16, 8, 1, 0, 8, 0,
+    0, 0, 8, 0, 2, 0, 8, 0, 8, 0, 16, 8, 1, 0, 8, 0, 0, 0, 8, 0, 2,
+    0, 0, 8, 0, 8, 0, 0, 0, 8, 0, 0, 0, 8, 0, 0, 0, 8, 0, 0, 0, 8,
+    0, 8, 0, 8, 0, 8, 0, 16, 8, 1, 0, 8, 0, 0, 0, 8, 0, 8, 0, 8, 0,
+    8, 0, 16, 8, 1, 0, 8, 0, 0, 0, 8, 0, 0, 0, 8, 0, 0, 0, 8, 0, 2,
+    0, 8, 1, 8, 1, 0, 2, 8, 1, 0, 2, 8, 1, 0, 2, 8, 1, 0, 2, 8, 1,
+    0, 2, 8, 1, 0, 2, 8, 1, 0, 2, 8, 1, 0, 2, 8, 1, 0, 2, 8, 1, 0,
+    2, 8, 1, 0, 2, 8, 1, 0, 2, 8, 1, 0, 2, 8, 1, 0, 2, 8, 1, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 8, 0, 0, 0, 4, 0, 4,
+    4, 8, 0, 0, 0, 8, 0, 8, 8, 1, 0, 0, 0, 4, 0, 4, 4, 8, 0, 0, 0,
+    8, 0, 8, 8, 1, 0, 0, 0, 4, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 4, 0, 8, 0, 4, 4, 8, 0, 8, 8, 1, 0, 4, 4, 8, 0, 8,
+    8, 1, 0, 4, 0, 8, 0, 0, 0, 2, 0, 4, 4, 8, 0, 8, 8, 1, 0, 4, 0,
+    8, 0, 0, 0, 2, 0, 4, 4, 8, 0, 8, 8, 1, 0, 4, 0, 8, 0, 0, 0, 2,
+    0, 0, 0, 0, 4, 0, 8, 0, 4, 0, 8, 0, 0, 0, 0, 0, 4, 0, 8, 0, 0,
+    0, 8, 0, 4, 0, 16, 0, 8, 8, 1, 0, 4, 0, 8, 0, 0, 0, 8, 0, 4, 0,
+    16, 0, 8, 8, 1, 0, 4, 0, 8, 0, 0, 0, 0, 0, 4, 0, 8, 0, 0, 0, 2,
+    0, 4, 8, 4, 8, 8, 1, 4, 8, 8, 1, 4, 8, 0, 2, 4, 8, 8, 1, 4, 8,
+    0, 2, 4, 8, 8, 1, 4, 8, 0, 2, 4, 8, 8, 1, 4, 8, 0, 2, 4, 8, 8,
+    1, 4, 8, 0, 2, 4, 8, 8, 1, 4, 8, 0, 2, 4, 8, 8, 1, 4, 8, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 4, 0, 4,
+    4, 8, 0, 0, 0, 8, 0, 8, 8, 1, 0, 0, 0, 4, 0, 4, 4, 8, 0, 0, 0,
+    8, 0, 8, 8, 1, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 4, 8, 4, 8, 0, 0, 4, 8, 0, 8, 4, 16, 8, 1, 4, 8, 0, 8, 4, 16,
+    8, 1, 4, 8, 0, 0, 4, 8, 0, 2, 4, 8, 0, 8, 4, 16, 8, 1, 4, 8, 0,
+    0, 4, 8, 0, 2, 4, 8, 0, 8, 4, 16, 8, 1, 4, 8, 0, 0, 4, 8, 0, 2,
+    0, 4, 8, 4, 8, 0, 0, 4, 8, 0, 0, 4, 8, 0, 0, 4, 8, 0, 0, 4, 8,
+    0, 8, 4, 8, 0, 8, 4, 16, 8, 1, 4, 8, 0, 0, 4, 8, 0, 8, 4, 8, 0,
+    8, 4, 16, 8, 1, 4, 8, 0, 0, 4, 8, 0, 0, 4, 8, 0, 0, 4, 8, 0, 2,
+    8, 8, 1, 8, 1, 8, 2, 8, 1, 8, 2, 8, 1, 8, 2, 8, 1, 8, 2, 8, 1,
+    8, 2, 8, 1, 8, 2, 8, 1, 8, 2, 8, 1, 8, 2, 8, 1, 8, 2, 8, 1, 8,
+    2, 8, 1, 8, 2, 8, 1, 8, 2, 8, 1, 8, 2, 8, 1, 8, 2, 8, 1, 8, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 8, 0, 0, 0, 4, 0, 4,
+    4, 8, 0, 0, 0, 8, 0, 8, 8, 1, 0, 0, 0, 4, 0, 4, 4, 8, 0, 0, 0,
+    8, 0, 8, 8, 1, 0, 0, 0, 4, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 8, 0, 4, 4, 8, 0, 8, 8, 1, 0, 4, 4, 8, 0, 8,
+    8, 1, 0, 0, 0, 8, 0, 0, 0, 2, 0, 4, 4, 8, 0, 8, 8, 1, 0, 0, 0,
+    8, 0, 0, 0, 2, 0, 4, 4, 8, 0, 8, 8, 1, 0, 0, 0, 8, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0,
+    0, 8, 0, 0, 0, 16, 0, 8, 8, 1, 0, 0, 0, 8, 0, 0, 0, 8, 0, 0, 0,
+    16, 0, 8, 8, 1, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 2,
+    8, 8, 0, 8, 8, 16, 1, 8, 8, 16, 1, 8, 0, 8, 2, 8, 8, 16, 1, 8, 0,
+    8, 2, 8, 8, 16, 1, 8, 0, 8, 2, 8, 8, 16, 1, 8, 0, 8, 2, 8, 8, 16,
+    1, 8, 0, 8, 2, 8, 8, 16, 1, 8, 0, 8, 2, 8, 8, 16, 1, 8, 0, 8, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 4, 0, 4,
+    4, 8, 0, 0, 0, 8, 0, 8, 8, 1, 0, 0, 0, 4, 0, 4, 4, 8, 0, 0, 0,
+    8, 0, 8, 8, 1, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 2,
+    8, 8, 0, 8, 0, 8, 0, 8, 0, 8, 8, 8, 8, 16, 1, 8, 0, 8, 8, 8, 8,
+    16, 1, 8, 0, 8, 0, 8, 0, 8, 2, 8, 0, 8, 8, 8, 8, 16, 1, 8, 0, 8,
+    0, 8, 0, 8, 2, 8, 0, 8, 8, 8, 8, 16, 1, 8, 0, 8, 0, 8, 0, 8, 2,
+    8, 8, 0, 8, 0, 8, 0, 8, 0, 8, 0, 8, 0, 8, 0, 8, 0, 8, 0, 8, 0,
+    8, 8, 8, 0, 8, 8, 8, 8, 16, 1, 8, 0, 8, 0, 8, 0, 8, 8, 8, 0, 8,
+    8, 8, 8, 16, 1, 8, 0, 8, 0, 8, 0, 8, 0, 8, 0, 8, 0, 8, 0, 8, 2,
+    1, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 8, 0, 0, 0, 4, 0, 4,
+    4, 8, 0, 0, 0, 8, 0, 8, 8, 1, 0, 0, 0, 4, 0, 4, 4, 8, 0, 0, 0,
+    8, 0, 8, 8, 1, 0, 0, 0, 4, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 4, 0, 8, 0, 4, 4, 8, 0, 8, 8, 1, 0, 4, 4, 8, 0, 8,
+    8, 1, 0, 4, 0, 8, 0, 0, 0, 2, 0, 4, 4, 8, 0, 8, 8, 1, 0, 4, 0,
+    8, 0, 0, 0, 2, 0, 4, 4, 8, 0, 8, 8, 1, 0, 4, 0, 8, 0, 0, 0, 2,
+    0, 0, 0, 0, 4, 0, 8, 0, 4, 0, 8, 0, 0, 0, 0, 0, 4, 0, 8, 0, 0,
+    0, 8, 0, 4, 0, 16, 0, 8, 8, 1, 0, 4, 0, 8, 0, 0, 0, 8, 0, 4, 0,
+    16, 0, 8, 8, 1, 0, 4, 0, 8, 0, 0, 0, 0, 0, 4, 0, 8, 0, 0, 0, 2,
+    0, 4, 8, 4, 8, 8, 1, 4, 8, 8, 1, 4, 8, 0, 2, 4, 8, 8, 1, 4, 8,
+    0, 2, 4, 8, 8, 1, 4, 8, 0, 2, 4, 8, 8, 1, 4, 8, 0, 2, 4, 8, 8,
+    1, 4, 8, 0, 2, 4, 8, 8, 1, 4, 8, 0, 2, 4, 8, 8, 1, 4, 8, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 4, 0, 4,
+    4, 8, 0, 0, 0, 8, 0, 8, 8, 1, 0, 0, 0, 4, 0, 4, 4, 8, 0, 0, 0,
+    8, 0, 8, 8, 1, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 4, 8, 4, 8, 0, 0, 4, 8, 0, 8, 4, 16, 8, 1, 4, 8, 0, 8, 4, 16,
+    8, 1, 4, 8, 0, 0, 4, 8, 0, 2, 4, 8, 0, 8, 4, 16, 8, 1, 4, 8, 0,
+    0, 4, 8, 0, 2, 4, 8, 0, 8, 4, 16, 8, 1, 4, 8, 0, 0, 4, 8, 0, 2,
+    0, 4, 8, 4, 8, 0, 0, 4, 8, 0, 0, 4, 8, 0, 0, 4, 8, 0, 0, 4, 8,
+    0, 8, 4, 8, 0, 8, 4, 16, 8, 1, 4, 8, 0, 0, 4, 8, 0, 8, 4, 8, 0,
+    8, 4, 16, 8, 1, 4, 8, 0, 0, 4, 8, 0, 0, 4, 8, 0, 0, 4, 8, 0, 2,
+    8, 8, 1, 8, 1, 8, 2, 8, 1, 8, 2, 8, 1, 8, 2, 8, 1, 8, 2, 8, 1,
+    8, 2, 8, 1, 8, 2, 8, 1, 8, 2, 8, 1, 8, 2, 8, 1, 8, 2, 8, 1, 8,
+    2, 8, 1, 8, 2, 8, 1, 8, 2, 8, 1, 8, 2, 8, 1, 8, 2, 8, 1, 8, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 8, 0, 0, 0, 4, 0, 4,
+    4, 8, 0, 0, 0, 8, 0, 8, 8, 1, 0, 0, 0, 4, 0, 4, 4, 8, 0, 0, 0,
+    8, 0, 8, 8, 1, 0, 0, 0, 4, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 8, 0, 4, 4, 8, 0, 8, 8, 1, 0, 4, 4, 8, 0, 8,
+    8, 1, 0, 0, 0, 8, 0, 0, 0, 2, 0, 4, 4, 8, 0, 8, 8, 1, 0, 0, 0,
+    8, 0, 0, 0, 2, 0, 4, 4, 8, 0, 8, 8, 1, 0, 0, 0, 8, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0,
+    0, 8, 0, 0, 0, 16, 0, 8, 8, 1, 0, 0, 0, 8, 0, 0, 0, 8, 0, 0, 0,
+    16, 0, 8, 8, 1, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 2,
+    8, 8, 0, 8, 8, 16, 1, 8, 8, 16, 1, 8, 0, 8, 2, 8, 8, 16, 1, 8, 0,
+    8, 2, 8, 8, 16, 1, 8, 0, 8, 2, 8, 8, 16, 1, 8, 0, 8, 2, 8, 8, 16,
+    1, 8, 0, 8, 2, 8, 8, 16, 1, 8, 0, 8, 2, 8, 8, 16, 1, 8, 0, 8, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 4, 0, 4,
+    4, 8, 0, 0, 0, 8, 0, 8, 8, 1, 0, 0, 0, 4, 0, 4, 4, 8, 0, 0, 0,
+    8, 0, 8, 8, 1, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 2,
+    8, 8, 0, 8, 0, 8, 0, 8, 0, 8, 8, 8, 8, 16, 1, 8, 0, 8, 8, 8, 8,
+    16, 1, 8, 0, 8, 0, 8, 0, 8, 2, 8, 0, 8, 8, 8, 8, 16, 1, 8, 0, 8,
+    0, 8, 0, 8, 2, 8, 0, 8, 8, 8, 8, 16, 1, 8, 0, 8, 0, 8, 0, 8, 2,
+    8, 8, 0, 8, 0, 8, 0, 8, 0, 8, 0, 8, 0, 8, 0, 8, 0, 8, 0, 8, 0,
+    8, 8, 8, 0, 8, 8, 8, 8, 16, 1, 8, 0, 8, 0, 8, 0, 8, 8, 8, 0, 8,
+    8, 8, 8, 16, 1, 8, 0, 8, 0, 8, 0, 8, 0, 8, 0, 8, 0, 8, 0, 8, 2,
+    1, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 8, 0, 0, 0, 4, 0, 4,
+    4, 8, 0, 0, 0, 8, 0, 8, 8, 1, 0, 0, 0, 4, 0, 4, 4, 8, 0, 0, 0,
+    8, 0, 8, 8, 1, 0, 0, 0, 4, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 4, 0, 8, 0, 4, 4, 8, 0, 8, 8, 1, 0, 4, 4, 8, 0, 8,
+    8, 1, 0, 4, 0, 8, 0, 0, 0, 2, 0, 4, 4, 8, 0, 8, 8, 1, 0, 4, 0,
+    8, 0, 0, 0, 2, 0, 4, 4, 8, 0, 8, 8, 1, 0, 4, 0, 8, 0, 0, 0, 2,
+    0, 0, 0, 0, 4, 0, 8, 0, 4, 0, 8, 0, 0, 0, 0, 0, 4, 0, 8, 0, 0,
+    0, 8, 0, 4, 0, 16, 0, 8, 8, 1, 0, 4, 0, 8, 0, 0, 0, 8, 0, 4, 0,
+    16, 0, 8, 8, 1, 0, 4, 0, 8, 0, 0, 0, 0, 0, 4, 0, 8, 0, 0, 0, 2,
+    0, 0, 8, 4, 8, 8, 1, 4, 8, 8, 1, 0, 8, 0, 2, 4, 8, 8, 1, 0, 8,
+    0, 2, 4, 8, 8, 1, 0, 8, 0, 2, 4, 8, 8, 1, 0, 8, 0, 2, 4, 8, 8,
+    1, 0, 8, 0, 2, 4, 8, 8, 1, 0, 8, 0, 2, 4, 8, 8, 1, 0, 8, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 4, 0, 4,
+    4, 8, 0, 0, 0, 8, 0, 8, 8, 1, 0, 0, 0, 4, 0, 4, 4, 8, 0, 0, 0,
+    8, 0, 8, 8, 1, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 8, 0, 8, 0, 0, 0, 8, 0, 8, 0, 16, 8, 1, 0, 8, 0, 8, 0, 16,
+    8, 1, 0, 8, 0, 0, 0, 8, 0, 2, 0, 8, 0, 8, 0, 16, 8, 1, 0, 8, 0,
+    0, 0, 8, 0, 2, 0, 8, 0, 8, 0, 16, 8, 1, 0, 8, 0, 0, 0, 8, 0, 2,
+    0, 0, 8, 0, 8, 0, 0, 0, 8, 0, 0, 0, 8, 0, 0, 0, 8, 0, 0, 0, 8,
+    0, 8, 0, 8, 0, 8, 0, 16, 8, 1, 0, 8, 0, 0, 0, 8, 0, 8, 0, 8, 0,
+    8, 0, 16, 8, 1, 0, 8, 0, 0, 0, 8, 0, 0, 0, 8, 0, 0, 0, 8, 0, 2,
+    0, 8, 1, 8, 1, 0, 2, 8, 1, 0, 2, 8, 1, 0, 2, 8, 1, 0, 2, 8, 1,
+    0, 2, 8, 1, 0, 2, 8, 1, 0, 2, 8, 1, 0, 2, 8, 1, 0, 2, 8, 1, 0,
+    2, 8, 1, 0, 2, 8, 1, 0, 2, 8, 1, 0, 2, 8, 1, 0, 2, 8, 1, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 8, 0, 0, 0, 4, 0, 4,
+    4, 8, 0, 0, 0, 8, 0, 8, 8, 1, 0, 0, 0, 4, 0, 4, 4, 8, 0, 0, 0,
+    8, 0, 8, 8, 1, 0, 0, 0, 4, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 8, 0, 4, 4, 8, 0, 8, 8, 1, 0, 4, 4, 8, 0, 8,
+    8, 1, 0, 0, 0, 8, 0, 0, 0, 2, 0, 4, 4, 8, 0, 8, 8, 1, 0, 0, 0,
+    8, 0, 0, 0, 2, 0, 4, 4, 8, 0, 8, 8, 1, 0, 0, 0, 8, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0,
+    0, 8, 0, 0, 0, 16, 0, 8, 8, 1, 0, 0, 0, 8, 0, 0, 0, 8, 0, 0, 0,
+    16, 0, 8, 8, 1, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 2,
+    0, 0, 0, 0, 8, 8, 1, 0, 8, 8, 1, 0, 0, 0, 2, 0, 8, 8, 1, 0, 0,
+    0, 2, 0, 8, 8, 1, 0, 0, 0, 2, 0, 8, 8, 1, 0, 0, 0, 2, 0, 8, 8,
+    1, 0, 0, 0, 2, 0, 8, 8, 1, 0, 0, 0, 2, 0, 8, 8, 1, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 4, 0, 4,
+    4, 8, 0, 0, 0, 8, 0, 8, 8, 1, 0, 0, 0, 4, 0, 4, 4, 8, 0, 0, 0,
+    8, 0, 8, 8, 1, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 8, 8, 1, 0, 0, 0, 8, 0, 8,
+    8, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 8, 0, 8, 8, 1, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 8, 0, 8, 8, 1, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 8, 0, 0, 0, 8, 0, 8, 8, 1, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0,
+    8, 0, 8, 8, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+};
+
+#endif
@@ -2,219 +2,3447 @@
 #include "SDL2/SDL_ttf.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
 #include <math.h>
+#include <time.h>
+#include "patterns.h"
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_X86_SIMD 1
+#endif
 
 #define CELL_SIZE 50
 #define WINDOW_WIDTH 400
 #define WINDOW_HEIGHT 500
-#define WINNING_LENGTH 5
+// Наибольшая длина ряда среди вариантов игры
+#define MAX_WINNING_LENGTH 6
+// Файл, в который F5 сохраняет позицию и из которого F9 её загружает
+#define POSITION_FILE "position.txt"
 
-typedef enum { EMPTY, PLAYER_X, PLAYER_O } Cell;
+// WALL — клетка рамки за краем конечного поля
+typedef enum { EMPTY, PLAYER_X, PLAYER_O, WALL } Cell;
 
-// Устанавливаем максимально возможный размер игрового поля
-#define MAX_SIZE 1000
-Cell board[MAX_SIZE][MAX_SIZE];
+// Поле бесконечное: оно хранится разреженно, плитками TILE_SIZE x TILE_SIZE клеток.
+// Плитка выделяется при первой записи, поэтому память растёт с числом ходов,
+// а не с площадью поля.
+#define TILE_SHIFT 5
+#define TILE_SIZE (1 << TILE_SHIFT)
+#define TILE_MASK (TILE_SIZE - 1)
+// Количество диагоналей одного направления в плитке
+#define TILE_DIAGS (2 * TILE_SIZE - 1)
+#define TILE_CELLS (TILE_SIZE * TILE_SIZE)
+// Длины рядов в таблицах ограничены сверху (по 4 бита на сторону)
+#define RUN_CAP 15
+// Начальный размер хеш-таблицы плиток
+#define TILE_SLOTS_INITIAL 64
 
-int cameraX = 0; // Координаты камеры по X
-int cameraY = 0; // Координаты камеры по Y
+// Радиус (по Чебышёву) окрестности камней, в которой лежат ходы-кандидаты
+#define CANDIDATE_RADIUS 2
 
-// Инициализация игрового поля
-void initBoard(int* emptyCells) {
-    *emptyCells = MAX_SIZE * MAX_SIZE; // Инициализируем количество пустых клеток
-    for (int i = 0; i < MAX_SIZE; i++)
-        for (int j = 0; j < MAX_SIZE; j++)
-            board[i][j] = EMPTY;
+// Фигуры, которые игрок получает на линии, поставив камень в пустую клетку
+// (k — длина выигрышного ряда)
+typedef enum {
+    SHAPE_NONE,
+    SHAPE_TWO,         // ещё ход — и открытая тройка
+    SHAPE_THREE,       // ещё ход — и четвёрка
+    SHAPE_OPEN_THREE,  // ещё ход — и открытая четвёрка
+    SHAPE_FOUR,        // ряд из k достраивается одной клеткой
+    SHAPE_OPEN_FOUR,   // ряд из k достраивается двумя разными клетками
+    SHAPE_FIVE,        // ряд из k готов
+} Shape;
+
+// Фигуры, для которых поле ведёт множества клеток: от SHAPE_OPEN_THREE до SHAPE_FIVE
+#define THREAT_LEVELS 4
+
+// Индексированные множества клеток, которые поддерживает поле
+enum {
+    SET_EMPTY,       // пустые клетки выделенных плиток
+    SET_CANDIDATES,  // пустые клетки не дальше CANDIDATE_RADIUS от какого-либо камня
+    // Пустые клетки, где игрок получает фигуру хотя бы на одной линии:
+    // SET_THREATS + игрок * THREAT_LEVELS + (фигура - SHAPE_OPEN_THREE)
+    SET_THREATS,
+    SET_COUNT = SET_THREATS + 2 * THREAT_LEVELS
+};
+
+// Плитка поля. У каждого игрока свои битовые плоскости; кроме строк храним
+// повёрнутые копии, чтобы любая линия через клетку читалась одним словом.
+typedef struct {
+    int64_t tx, ty;                     // координаты плитки: клетка (x, y) лежит в (x >> TILE_SHIFT, y >> TILE_SHIFT)
+    uint32_t gen;                       // поколение поля, в котором плитка последний раз записывалась
+    uint32_t index;                     // номер плитки в массиве tiles поля
+    int stones;                         // количество камней в плитке
+    uint32_t rows[2][TILE_SIZE];        // бит lx строки ly
+    uint32_t cols[2][TILE_SIZE];        // бит ly столбца lx
+    uint32_t diags[2][TILE_DIAGS];      // диагональ (1, 1) с номером lx - ly + TILE_SIZE - 1, бит lx
+    uint32_t antiDiags[2][TILE_DIAGS];  // диагональ (1, -1) с номером lx + ly, бит lx
+    // Длины рядов игрока по направлению d вокруг клетки ly * TILE_SIZE + lx:
+    // младшие 4 бита — сколько его символов подряд стоит перед клеткой,
+    // старшие — сколько подряд после неё (не больше RUN_CAP)
+    uint8_t runs[2][4][TILE_CELLS];
+    // Количество камней в окрестности радиуса CANDIDATE_RADIUS вокруг клетки (без неё самой)
+    uint8_t near[TILE_CELLS];
+    // Фигура (Shape) игрока на линии направления d, если он поставит камень в пустую клетку
+    uint8_t shapes[2][4][TILE_CELLS];
+    // Позиция клетки в каждом множестве клеток поля плюс один (0 — клетки в нём нет)
+    uint32_t setSlots[SET_COUNT][TILE_CELLS];
+} Tile;
+
+// Индексированное множество клеток: массив ссылок на клетки, а позиция каждой клетки
+// в массиве хранится в её плитке. Добавление, удаление и выбор случайной клетки — O(1).
+typedef struct {
+    uint32_t* items;    // ссылки на клетки: (номер плитки << 2 * TILE_SHIFT) | номер клетки в плитке
+    uint32_t count;
+    uint32_t capacity;
+} CellSet;
+
+// Выигрышная линия: первая клетка, направление и длина
+typedef struct {
+    int64_t x, y;
+    int dx, dy;
+    int length;
+    Cell player;
+} WinLine;
+
+// Запись о ходе в стеке ходов: сам ход и состояние поля, которое он изменил
+// и которое нельзя вернуть обратным пересчётом
+typedef struct {
+    int64_t x, y;
+    Cell player;
+    uint64_t hash;   // ключ позиции до хода
+    int64_t stones;  // количество камней до хода
+    int64_t minX, minY, maxX, maxY; // прямоугольник камней до хода
+} MoveRecord;
+
+// Ширина рамки из клеток WALL вокруг конечного поля
+#define PADDING MAX_WINNING_LENGTH
+
+// Небольшое конечное поле целиком в нескольких 64-битных словах на игрока
+#define PACKED_WORDS 6
+#define PACKED_BITS (PACKED_WORDS * 64)
+
+// Упакованная копия конечного поля: клетка (x, y) — бит y * stride + x, где
+// stride = size + 1. Лишний столбец всегда пуст и отделяет строки друг от друга,
+// поэтому ряды ищутся сдвигами всего поля без масок краёв.
+typedef struct {
+    int words;                            // используемые слова; 0 — поле не помещается
+    int stride;
+    uint64_t stones[2][PACKED_WORDS];
+    uint64_t valid[PACKED_WORDS];         // клетки поля (без лишнего столбца)
+} PackedBoard;
+
+// Разреженное игровое поле: хеш-таблица плиток с открытой адресацией
+typedef struct {
+    int64_t size;         // сторона конечного поля с клетками от (0, 0) до (size - 1, size - 1); 0 — поле бесконечное
+    int64_t wrapMask;     // на торе (size — степень двойки) size - 1: координаты заворачиваются маской; иначе 0
+    Tile** slots;         // слоты хеш-таблицы, NULL — свободный слот
+    uint32_t slotMask;    // размер таблицы минус один (размер — степень двойки)
+    Tile** tiles;         // выделенные плитки в порядке выделения
+    uint32_t tileCount;   // количество выделенных плиток
+    uint32_t tileCapacity;
+    uint32_t generation;  // плитки из других поколений считаются пустыми
+    int64_t stones;       // количество занятых клеток
+    int64_t minX, minY;   // наименьший прямоугольник, содержащий все камни
+    int64_t maxX, maxY;   // (имеет смысл, только если stones > 0)
+    uint64_t hash;        // ключ Зобриста текущей позиции
+    MoveRecord* history;  // стек сделанных ходов; за его вершиной лежат отменённые ходы для повтора
+    int historyTop;       // количество сделанных ходов
+    int historyLength;    // сделанные ходы плюс отменённые, которые можно повторить
+    int historyCapacity;
+    CellSet sets[SET_COUNT];
+    WinLine winLine;      // линия, которой закончилась партия (length == 0 — победителя нет)
+    PackedBoard packed;   // упакованная копия конечного поля, если оно помещается в PACKED_BITS
+    // Копия конечного поля клетками в рамке из PADDING клеток WALL: обход соседей
+    // идёт сдвигом указателя и останавливается на рамке без проверок границ
+    uint8_t* padded;
+    int64_t paddedStride;
+    int64_t paddedOffsets[4]; // сдвиги указателя вдоль directions
+    // Окна из winLength клеток подряд на конечном поле: для окна с началом (x, y) по направлению d
+    // windowStones[p][(y * size + x) * 4 + d] — сколько в нём камней игрока p.
+    // Окно живо, пока в нём нет камней хотя бы одного из игроков.
+    int winLength;
+    uint8_t* windowStones[2];
+    int64_t liveWindows;  // когда живых окон не осталось, никто уже не выиграет
+    // Сумма весов shapeWeights фигур игрока по всем пустым клеткам и линиям — оценка позиции за O(1)
+    int64_t threatScore[2];
+} Board;
+
+Board board;
+
+// Вариант игры: длина ряда, размер поля и специализированные под них функции
+typedef struct {
+    const char* name;
+    int k;          // сколько символов подряд нужно для победы
+    int64_t size;   // сторона поля, 0 — поле бесконечное
+    int torus;      // поле свёрнуто в тор (size — степень двойки, не больше TILE_SIZE)
+    // Привёл бы символ игрока в пустой клетке (x, y) к победе: номер направления
+    // выигрышной линии в directions плюс один, 0 — победы нет
+    int (*wouldWin)(const Board* b, Cell player, int64_t x, int64_t y);
+    // Поиск хода-кандидата, которым игрок сразу выигрывает; 0, если такого нет
+    int (*findWinningMove)(const Board* b, Cell player, int64_t* x, int64_t* y);
+} Variant;
+
+// Текущий вариант игры (выбирается при запуске)
+const Variant* variant;
+
+// Правила победы и запрещённых ходов
+typedef struct {
+    const char* name;
+    // Привёл бы символ игрока в пустой клетке (x, y) к победе по этим правилам
+    // (как Variant.wouldWin: направление выигрышной линии плюс один или 0)
+    int (*wouldWin)(const Board* b, Cell player, int64_t x, int64_t y);
+    // Поиск хода-кандидата, которым игрок сразу выигрывает; 0, если такого нет
+    int (*findWinningMove)(const Board* b, Cell player, int64_t* x, int64_t* y);
+    // Запрещён ли игроку ход в пустую клетку (x, y); NULL — запретов нет
+    int (*isForbidden)(const Board* b, Cell player, int64_t x, int64_t y);
+    unsigned exactPlayers;  // бит player: этому игроку засчитывается только ряд ровно из k
+} RuleSet;
+
+// Текущие правила (выбираются при запуске)
+const RuleSet* rules;
+
+int64_t cameraX = 0; // Координаты камеры по X
+int64_t cameraY = 0; // Координаты камеры по Y
+
+// Направления линий: горизонталь, вертикаль и две диагонали
+static const int directions[4][2] = {{1, 0}, {0, 1}, {1, 1}, {1, -1}};
+
+// Деление с округлением вниз (для отрицательных координат)
+static inline int64_t floorDiv(int64_t a, int64_t b) {
+    int64_t q = a / b;
+    return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+}
+
+// Хеш координат плитки
+static inline uint32_t tileHash(int64_t tx, int64_t ty) {
+    uint64_t h = (uint64_t)tx * 0x9E3779B97F4A7C15ULL ^ (uint64_t)ty * 0xC2B2AE3D27D4EB4FULL;
+    return (uint32_t)(h ^ (h >> 32));
+}
+
+// Поиск плитки в хеш-таблице (в том числе устаревшей)
+static inline Tile* findTile(const Board* b, int64_t tx, int64_t ty) {
+    if (!b->slots) return NULL;
+    for (uint32_t i = tileHash(tx, ty) & b->slotMask;; i = (i + 1) & b->slotMask) {
+        Tile* tile = b->slots[i];
+        if (!tile || (tile->tx == tx && tile->ty == ty))
+            return tile;
+    }
+}
+
+// Плитка для чтения: отсутствующая или устаревшая плитка читается как пустая
+static inline const Tile* readTile(const Board* b, int64_t tx, int64_t ty) {
+    const Tile* tile = findTile(b, tx, ty);
+    return tile && tile->gen == b->generation ? tile : NULL;
+}
+
+// Вставка плитки в слоты без проверки заполненности
+static void insertTile(Tile** slots, uint32_t mask, Tile* tile) {
+    uint32_t i = tileHash(tile->tx, tile->ty) & mask;
+    while (slots[i]) i = (i + 1) & mask;
+    slots[i] = tile;
+}
+
+// Выделение памяти с завершением программы при нехватке
+static void* checkedRealloc(void* ptr, size_t size) {
+    ptr = realloc(ptr, size);
+    if (!ptr) {
+        printf("Out of memory\n");
+        exit(1);
+    }
+    return ptr;
+}
+
+static void* checkedCalloc(size_t count, size_t size) {
+    void* ptr = calloc(count, size);
+    if (!ptr) {
+        printf("Out of memory\n");
+        exit(1);
+    }
+    return ptr;
+}
+
+// Увеличение хеш-таблицы вдвое
+static void growTiles(Board* b) {
+    uint32_t size = b->slots ? (b->slotMask + 1) * 2 : TILE_SLOTS_INITIAL;
+    Tile** slots = checkedCalloc(size, sizeof(Tile*));
+    if (b->slots) {
+        for (uint32_t i = 0; i <= b->slotMask; i++)
+            if (b->slots[i]) insertTile(slots, size - 1, b->slots[i]);
+        free(b->slots);
+    }
+    b->slots = slots;
+    b->slotMask = size - 1;
+}
+
+// Ссылка на клетку плитки для множеств клеток
+static inline uint32_t cellRef(const Tile* tile, int local) {
+    return tile->index << (2 * TILE_SHIFT) | (uint32_t)local;
+}
+
+// Добавление клетки в множество
+static inline void cellSetAdd(Board* b, int set, Tile* tile, int local) {
+    CellSet* cs = &b->sets[set];
+    if (tile->setSlots[set][local]) return;
+    if (cs->count == cs->capacity) {
+        cs->capacity = cs->capacity ? cs->capacity * 2 : 1024;
+        cs->items = checkedRealloc(cs->items, cs->capacity * sizeof(uint32_t));
+    }
+    cs->items[cs->count++] = cellRef(tile, local);
+    tile->setSlots[set][local] = cs->count;
+}
+
+// Удаление клетки из множества: на её место переносится последний элемент
+static inline void cellSetRemove(Board* b, int set, Tile* tile, int local) {
+    CellSet* cs = &b->sets[set];
+    uint32_t slot = tile->setSlots[set][local];
+    if (!slot) return;
+    uint32_t last = cs->items[--cs->count];
+    if (slot - 1 != cs->count) {
+        cs->items[slot - 1] = last;
+        b->tiles[last >> (2 * TILE_SHIFT)]->setSlots[set][last & (TILE_CELLS - 1)] = slot;
+    }
+    tile->setSlots[set][local] = 0;
+}
+
+// Координаты клетки по ссылке из множества
+static inline void cellCoords(const Board* b, uint32_t ref, int64_t* x, int64_t* y) {
+    const Tile* tile = b->tiles[ref >> (2 * TILE_SHIFT)];
+    *x = tile->tx * TILE_SIZE + (ref & TILE_MASK);
+    *y = tile->ty * TILE_SIZE + ((ref >> TILE_SHIFT) & TILE_MASK);
+}
+
+// Лежит ли клетка на поле
+static inline int onBoard(const Board* b, int64_t x, int64_t y) {
+    return b->size == 0 || (x >= 0 && y >= 0 && x < b->size && y < b->size);
+}
+
+// Подключение новой или очищенной плитки: все её клетки пусты
+static void activateTile(Board* b, Tile* tile) {
+    for (int local = 0; local < TILE_CELLS; local++)
+        if (onBoard(b, tile->tx * TILE_SIZE + (local & TILE_MASK), tile->ty * TILE_SIZE + (local >> TILE_SHIFT)))
+            cellSetAdd(b, SET_EMPTY, tile, local);
+}
+
+// Плитка для записи: выделяется при первом обращении, устаревшая очищается
+static Tile* writeTile(Board* b, int64_t tx, int64_t ty) {
+    Tile* tile = findTile(b, tx, ty);
+    if (!tile) {
+        if (!b->slots || (b->tileCount + 1) * 2 > b->slotMask + 1)
+            growTiles(b);
+        if (b->tileCount == b->tileCapacity) {
+            b->tileCapacity = b->tileCapacity ? b->tileCapacity * 2 : 64;
+            b->tiles = checkedRealloc(b->tiles, b->tileCapacity * sizeof(Tile*));
+        }
+        tile = checkedCalloc(1, sizeof(Tile));
+        tile->tx = tx;
+        tile->ty = ty;
+        tile->gen = b->generation;
+        tile->index = b->tileCount;
+        insertTile(b->slots, b->slotMask, tile);
+        b->tiles[b->tileCount++] = tile;
+        activateTile(b, tile);
+    } else if (tile->gen != b->generation) {
+        memset(tile->rows, 0, sizeof(Tile) - offsetof(Tile, rows));
+        tile->stones = 0;
+        tile->gen = b->generation;
+        activateTile(b, tile);
+    }
+    return tile;
+}
+
+// Чтение клетки поля (на торе — с заворачиванием координат)
+static inline Cell getCell(const Board* b, int64_t x, int64_t y) {
+    if (b->wrapMask) {
+        x &= b->wrapMask;
+        y &= b->wrapMask;
+    }
+    const Tile* tile = readTile(b, x >> TILE_SHIFT, y >> TILE_SHIFT);
+    if (!tile) return EMPTY;
+    int lx = x & TILE_MASK, ly = y & TILE_MASK;
+    if (tile->rows[0][ly] >> lx & 1) return PLAYER_X;
+    if (tile->rows[1][ly] >> lx & 1) return PLAYER_O;
+    return EMPTY;
+}
+
+// Изменение бита клетки во всех четырёх плоскостях игрока
+static inline void flipTileBits(Tile* tile, int p, int lx, int ly) {
+    tile->rows[p][ly] ^= 1u << lx;
+    tile->cols[p][lx] ^= 1u << ly;
+    tile->diags[p][lx - ly + TILE_SIZE - 1] ^= 1u << lx;
+    tile->antiDiags[p][lx + ly] ^= 1u << lx;
+}
+
+// Перемешивание 64-битного числа (финализатор splitmix64)
+static inline uint64_t mix64(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Ключ Зобриста для символа игрока p в клетке (x, y). Таблица ключей не хранится:
+// ключ вычисляется по координатам при обращении, поэтому бесконечному полю не нужна
+// таблица случайных чисел, а ключи одинаковы во всех запусках программы.
+static inline uint64_t zobristKey(int p, int64_t x, int64_t y) {
+    return mix64(mix64((uint64_t)x + 0x9E3779B97F4A7C15ULL) ^ ((uint64_t)y << 1 | (uint64_t)p));
+}
+
+// Ячейка таблицы рядов для клетки (x, y) в плитке
+#define RUN_INDEX(x, y) ((((y) & TILE_MASK) << TILE_SHIFT) | ((x) & TILE_MASK))
+
+// Длина ряда игрока по направлению d, который получится через клетку (x, y),
+// если в ней стоит (или будет стоять) его символ
+static inline int lineLength(const Board* b, Cell player, int64_t x, int64_t y, int d) {
+    const Tile* tile = readTile(b, x >> TILE_SHIFT, y >> TILE_SHIFT);
+    if (!tile) return 1;
+    uint8_t run = tile->runs[player - PLAYER_X][d][RUN_INDEX(x, y)];
+    return (run & 15) + (run >> 4) + 1;
+}
+
+// Курсор по клеткам одной линии: помнит последнюю плитку, чтобы не искать её на каждом шаге
+static inline uint8_t* runCursor(Board* b, Tile** cache, int p, int d, int64_t x, int64_t y) {
+    int64_t tx = x >> TILE_SHIFT, ty = y >> TILE_SHIFT;
+    if (!*cache || (*cache)->tx != tx || (*cache)->ty != ty)
+        *cache = writeTile(b, tx, ty);
+    return &(*cache)->runs[p][d][RUN_INDEX(x, y)];
+}
+
+// Обновление таблиц рядов после того, как символ игрока p поставлен в клетку (x, y)
+// или убран из неё. Меняются только клетки того же ряда и первые клетки за его концами.
+static void updateRuns(Board* b, int p, int64_t x, int64_t y, int placed) {
+    Tile* tile = writeTile(b, x >> TILE_SHIFT, y >> TILE_SHIFT);
+    for (int d = 0; d < 4; d++) {
+        int dx = directions[d][0], dy = directions[d][1];
+        uint8_t run = tile->runs[p][d][RUN_INDEX(x, y)];
+        int before = run & 15, after = run >> 4;
+        Tile* cache = tile;
+
+        // Клетки позади: сколько символов подряд теперь стоит после них
+        for (int t = 1; t <= before + 1 && t <= RUN_CAP; t++) {
+            uint8_t* cell = runCursor(b, &cache, p, d, x - t * dx, y - t * dy);
+            int len = placed ? t + after : t - 1;
+            *cell = (*cell & 15) | (len < RUN_CAP ? len : RUN_CAP) << 4;
+        }
+        // Клетки впереди: сколько символов подряд теперь стоит перед ними
+        cache = tile;
+        for (int t = 1; t <= after + 1 && t <= RUN_CAP; t++) {
+            uint8_t* cell = runCursor(b, &cache, p, d, x + t * dx, y + t * dy);
+            int len = placed ? t + before : t - 1;
+            *cell = (*cell & 0xF0) | (len < RUN_CAP ? len : RUN_CAP);
+        }
+    }
+}
+
+// Занята ли клетка плитки
+static inline int tileCellOccupied(const Tile* tile, int lx, int ly) {
+    return ((tile->rows[0][ly] | tile->rows[1][ly]) >> lx) & 1;
+}
+
+// Обновление счётчиков соседства и множества кандидатов вокруг клетки (x, y),
+// в которую поставили камень (delta = 1) или с которой его сняли (delta = -1)
+static void updateCandidates(Board* b, int64_t x, int64_t y, int delta) {
+    Tile* cache = NULL;
+    for (int64_t wy = y - CANDIDATE_RADIUS; wy <= y + CANDIDATE_RADIUS; wy++) {
+        for (int64_t wx = x - CANDIDATE_RADIUS; wx <= x + CANDIDATE_RADIUS; wx++) {
+            if (wx == x && wy == y) continue;
+            // На торе окрестность переходит через край поля
+            int64_t nx = b->wrapMask ? wx & b->wrapMask : wx;
+            int64_t ny = b->wrapMask ? wy & b->wrapMask : wy;
+            int64_t tx = nx >> TILE_SHIFT, ty = ny >> TILE_SHIFT;
+            if (!cache || cache->tx != tx || cache->ty != ty)
+                cache = writeTile(b, tx, ty);
+            int local = RUN_INDEX(nx, ny);
+            cache->near[local] += delta;
+            if (tileCellOccupied(cache, nx & TILE_MASK, ny & TILE_MASK) || !onBoard(b, nx, ny)) continue;
+            if (delta > 0 && cache->near[local] == 1)
+                cellSetAdd(b, SET_CANDIDATES, cache, local);
+            else if (delta < 0 && cache->near[local] == 0)
+                cellSetRemove(b, SET_CANDIDATES, cache, local);
+        }
+    }
+}
+
+// Изменение бита клетки в упакованной копии поля
+static inline void flipPackedBit(PackedBoard* packed, int p, int64_t x, int64_t y) {
+    if (!packed->words) return;
+    int bit = (int)(y * packed->stride + x);
+    packed->stones[p][bit >> 6] ^= 1ull << (bit & 63);
+}
+
+// Клетка (x, y) конечного поля в копии с рамкой
+static inline uint8_t* paddedCell(const Board* b, int64_t x, int64_t y) {
+    return b->padded + (y + PADDING) * b->paddedStride + x + PADDING;
+}
+
+// Подготовка копии конечного поля с рамкой: внутри пусто, вокруг WALL
+static void initPaddedBoard(Board* b, int64_t size) {
+    if (size == 0) {
+        free(b->padded);
+        b->padded = NULL;
+        return;
+    }
+    int64_t stride = size + 2 * PADDING;
+    b->padded = checkedRealloc(b->padded, stride * stride);
+    b->paddedStride = stride;
+    memset(b->padded, WALL, stride * stride);
+    for (int64_t y = 0; y < size; y++)
+        memset(paddedCell(b, 0, y), EMPTY, size);
+    for (int d = 0; d < 4; d++)
+        b->paddedOffsets[d] = directions[d][1] * stride + directions[d][0];
+}
+
+// Подготовка пустой упакованной копии поля со стороной size
+static void initPackedBoard(PackedBoard* packed, int64_t size) {
+    memset(packed, 0, sizeof(*packed));
+    if (size == 0 || size * (size + 1) > PACKED_BITS) return;
+    packed->stride = (int)size + 1;
+    packed->words = (int)((size * packed->stride + 63) / 64);
+    for (int y = 0; y < size; y++)
+        for (int x = 0; x < size; x++)
+            packed->valid[(y * packed->stride + x) >> 6] |= 1ull << ((y * packed->stride + x) & 63);
+}
+
+// Номер окна с началом (x, y) по направлению d или -1, если окно выходит за поле
+static inline int64_t windowIndex(const Board* b, int64_t x, int64_t y, int d) {
+    if (b->wrapMask) {
+        x &= b->wrapMask;
+        y &= b->wrapMask;
+    } else if (!onBoard(b, x, y) || !onBoard(b, x + (b->winLength - 1) * directions[d][0], y + (b->winLength - 1) * directions[d][1])) {
+        return -1;
+    }
+    return (y * b->size + x) * 4 + d;
+}
+
+// Подготовка счётчиков окон конечного поля: все окна пусты и живы
+static void initWindows(Board* b) {
+    for (int p = 0; p < 2; p++) {
+        free(b->windowStones[p]);
+        b->windowStones[p] = NULL;
+    }
+    b->liveWindows = 0;
+    if (!b->size || b->winLength <= 0 || b->winLength > b->size) return;
+    for (int p = 0; p < 2; p++)
+        b->windowStones[p] = checkedCalloc(b->size * b->size * 4, 1);
+    for (int64_t y = 0; y < b->size; y++)
+        for (int64_t x = 0; x < b->size; x++)
+            for (int d = 0; d < 4; d++)
+                b->liveWindows += windowIndex(b, x, y, d) >= 0;
+}
+
+// Обновление окон, проходящих через клетку (x, y), после постановки (delta = 1)
+// или снятия (delta = -1) камня игрока p
+static void updateWindows(Board* b, int p, int64_t x, int64_t y, int delta) {
+    if (!b->windowStones[0]) return;
+    for (int d = 0; d < 4; d++) {
+        for (int j = 0; j < b->winLength; j++) {
+            int64_t w = windowIndex(b, x - j * directions[d][0], y - j * directions[d][1], d);
+            if (w < 0) continue;
+            uint8_t* own = &b->windowStones[p][w];
+            int wasLive = *own == 0 || b->windowStones[!p][w] == 0;
+            *own += delta;
+            int isLive = *own == 0 || b->windowStones[!p][w] == 0;
+            b->liveWindows += isLive - wasLive;
+        }
+    }
+}
+
+// Таблицы образцов линий (patterns.h, их печатает genpatterns.c). Линия через клетку —
+// по PATTERN_RADIUS клеток с каждой стороны. Каждая сторона сводится к номеру: клетки
+// до первой блокирующей (камень соперника или край поля) — b штук и камни игрока own
+// среди них дают номер (1 << b) - 1 + own; клетки за блокирующей ни на что не влияют.
+_Static_assert(PATTERN_RADIUS == MAX_WINNING_LENGTH - 1, "patterns.h built for another line radius");
+_Static_assert(PATTERN_MAX_K >= MAX_WINNING_LENGTH, "patterns.h lacks shape tables for long rows");
+
+// Номер стороны линии по маскам камней игрока и блокирующих клеток (бит i — удаление i + 1)
+static inline int patternSide(uint32_t own, uint32_t blocked) {
+    int open = __builtin_ctz(blocked | 1u << PATTERN_RADIUS);
+    return (1 << open) - 1 + (int)(own & ((1u << open) - 1));
+}
+
+// Множество клеток, где игрок p получает фигуру shape (от SHAPE_OPEN_THREE до SHAPE_FIVE)
+static inline int threatSet(int p, Shape shape) {
+    return SET_THREATS + p * THREAT_LEVELS + (shape - SHAPE_OPEN_THREE);
+}
+
+// Камни обоих игроков и клетки за краем поля на линии направления d вокруг (x, y):
+// бит t + 2 * PATTERN_RADIUS соответствует клетке со сдвигом t
+static void gatherLine(const Board* b, int64_t x, int64_t y, int d, uint32_t stones[2], uint32_t* off) {
+    stones[0] = stones[1] = *off = 0;
+    if (b->padded) {
+        // На конечном поле идём по копии с рамкой от клетки в обе стороны до стены:
+        // всё, что за ней, лежит за краем поля
+        const uint8_t* center = paddedCell(b, x, y);
+        int64_t step = b->paddedOffsets[d];
+        if (*center != EMPTY) stones[*center - PLAYER_X] |= 1u << 2 * PATTERN_RADIUS;
+        for (int side = -1; side <= 1; side += 2) {
+            int t = side;
+            for (; t >= -2 * PATTERN_RADIUS && t <= 2 * PATTERN_RADIUS; t += side) {
+                uint8_t cell = center[t * step];
+                if (cell == WALL) break;
+                if (cell != EMPTY) stones[cell - PLAYER_X] |= 1u << (t + 2 * PATTERN_RADIUS);
+            }
+            for (; t >= -2 * PATTERN_RADIUS && t <= 2 * PATTERN_RADIUS; t += side)
+                *off |= 1u << (t + 2 * PATTERN_RADIUS);
+        }
+        return;
+    }
+
+    const Tile* tile = NULL;
+    int64_t tileX = 0, tileY = 0;
+    int haveTile = 0;
+    for (int t = -2 * PATTERN_RADIUS; t <= 2 * PATTERN_RADIUS; t++) {
+        int64_t cx = x + t * directions[d][0], cy = y + t * directions[d][1];
+        uint32_t bit = 1u << (t + 2 * PATTERN_RADIUS);
+        if (b->wrapMask) {
+            cx &= b->wrapMask;
+            cy &= b->wrapMask;
+        } else if (!onBoard(b, cx, cy)) {
+            *off |= bit;
+            continue;
+        }
+        if (!haveTile || cx >> TILE_SHIFT != tileX || cy >> TILE_SHIFT != tileY) {
+            tileX = cx >> TILE_SHIFT;
+            tileY = cy >> TILE_SHIFT;
+            tile = readTile(b, tileX, tileY);
+            haveTile = 1;
+        }
+        if (!tile) continue;
+        int lx = cx & TILE_MASK, ly = cy & TILE_MASK;
+        if (tile->rows[0][ly] >> lx & 1) stones[0] |= bit;
+        if (tile->rows[1][ly] >> lx & 1) stones[1] |= bit;
+    }
+}
+
+// Вес фигуры в оценке позиции
+static const int shapeWeights[SHAPE_FIVE + 1] = {0, 1, 4, 12, 20, 150, 1000};
+
+// Запись фигуры клетки с синхронизацией множеств угроз: клетка лежит в множестве
+// фигуры, пока эта фигура есть хотя бы на одной из четырёх линий
+static inline void setShape(Board* b, Tile* tile, int local, int p, int d, uint8_t shape) {
+    uint8_t old = tile->shapes[p][d][local];
+    if (old == shape) return;
+    tile->shapes[p][d][local] = shape;
+    b->threatScore[p] += shapeWeights[shape] - shapeWeights[old];
+    for (int level = SHAPE_OPEN_THREE; level <= SHAPE_FIVE; level++) {
+        if (old != level && shape != level) continue;
+        int present = 0;
+        for (int other = 0; other < 4; other++)
+            present |= tile->shapes[p][other][local] == level;
+        if (present)
+            cellSetAdd(b, threatSet(p, level), tile, local);
+        else
+            cellSetRemove(b, threatSet(p, level), tile, local);
+    }
+}
+
+// Пересчёт фигур после изменения камня в клетке (x, y): меняются только окна
+// четырёх линий через неё, поэтому пересчитываются клетки этих линий на удалении
+// до PATTERN_RADIUS, каждая одним чтением таблицы на игрока
+static void updateThreats(Board* b, int64_t x, int64_t y) {
+    const uint8_t* patterns = shapePatterns[b->winLength - PATTERN_MIN_K];
+    for (int d = 0; d < 4; d++) {
+        uint32_t stones[2], off;
+        gatherLine(b, x, y, d, stones, &off);
+        Tile* cache = NULL;
+        for (int t = -PATTERN_RADIUS; t <= PATTERN_RADIUS; t++) {
+            int shift = t + 2 * PATTERN_RADIUS;
+            if (off >> shift & 1) continue;
+            int64_t cx = x + t * directions[d][0], cy = y + t * directions[d][1];
+            if (b->wrapMask) {
+                cx &= b->wrapMask;
+                cy &= b->wrapMask;
+            }
+            if (!cache || cache->tx != cx >> TILE_SHIFT || cache->ty != cy >> TILE_SHIFT)
+                cache = writeTile(b, cx >> TILE_SHIFT, cy >> TILE_SHIFT);
+            int local = RUN_INDEX(cx, cy);
+            int occupied = ((stones[0] | stones[1]) >> shift) & 1;
+            for (int p = 0; p < 2; p++) {
+                uint8_t shape = SHAPE_NONE;
+                if (!occupied) {
+                    // Окно клетки: биты 0..2 * PATTERN_RADIUS, сама клетка в бите PATTERN_RADIUS
+                    uint32_t own = stones[p] >> (shift - PATTERN_RADIUS);
+                    uint32_t blocked = (stones[!p] | off) >> (shift - PATTERN_RADIUS);
+                    int left = patternSide(reversed5[own & 31], reversed5[blocked & 31]);
+                    int right = patternSide((own >> (PATTERN_RADIUS + 1)) & 31, (blocked >> (PATTERN_RADIUS + 1)) & 31);
+                    shape = patterns[left * PATTERN_SIDE + right];
+                }
+                setShape(b, cache, local, p, d, shape);
+            }
+        }
+    }
+}
+
+// Фигура, которую игрок получит на линии d, поставив камень в пустую клетку (x, y)
+static inline Shape threatShape(const Board* b, Cell player, int64_t x, int64_t y, int d) {
+    if (b->wrapMask) {
+        x &= b->wrapMask;
+        y &= b->wrapMask;
+    }
+    const Tile* tile = readTile(b, x >> TILE_SHIFT, y >> TILE_SHIFT);
+    return tile ? (Shape)tile->shapes[player - PLAYER_X][d][RUN_INDEX(x, y)] : SHAPE_NONE;
+}
+
+// Сильнейшая фигура игрока по четырём линиям через пустую клетку (x, y)
+static inline Shape bestThreat(const Board* b, Cell player, int64_t x, int64_t y) {
+    Shape best = SHAPE_NONE;
+    for (int d = 0; d < 4; d++) {
+        Shape shape = threatShape(b, player, x, y, d);
+        if (shape > best) best = shape;
+    }
+    return best;
+}
+
+// Постановка символа игрока p в пустую клетку: битовые плоскости, таблицы рядов
+// и множества пустых клеток и кандидатов
+static inline void placeStone(Board* b, int p, int64_t x, int64_t y) {
+    Tile* tile = writeTile(b, x >> TILE_SHIFT, y >> TILE_SHIFT);
+    int local = RUN_INDEX(x, y);
+    flipTileBits(tile, p, x & TILE_MASK, y & TILE_MASK);
+    flipPackedBit(&b->packed, p, x, y);
+    if (b->padded) *paddedCell(b, x, y) = PLAYER_X + p;
+    tile->stones++;
+    cellSetRemove(b, SET_EMPTY, tile, local);
+    cellSetRemove(b, SET_CANDIDATES, tile, local);
+    updateRuns(b, p, x, y, 1);
+    updateCandidates(b, x, y, 1);
+    updateWindows(b, p, x, y, 1);
+    updateThreats(b, x, y);
+}
+
+// Снятие символа игрока p с клетки
+static inline void removeStone(Board* b, int p, int64_t x, int64_t y) {
+    Tile* tile = writeTile(b, x >> TILE_SHIFT, y >> TILE_SHIFT);
+    int local = RUN_INDEX(x, y);
+    flipTileBits(tile, p, x & TILE_MASK, y & TILE_MASK);
+    flipPackedBit(&b->packed, p, x, y);
+    if (b->padded) *paddedCell(b, x, y) = EMPTY;
+    tile->stones--;
+    cellSetAdd(b, SET_EMPTY, tile, local);
+    if (tile->near[local] && onBoard(b, x, y))
+        cellSetAdd(b, SET_CANDIDATES, tile, local);
+    updateRuns(b, p, x, y, 0);
+    updateCandidates(b, x, y, -1);
+    updateWindows(b, p, x, y, -1);
+    updateThreats(b, x, y);
+}
+
+// Является ли клетка ходом-кандидатом (пустая и рядом с камнем)
+static inline int isCandidate(const Board* b, int64_t x, int64_t y) {
+    const Tile* tile = readTile(b, x >> TILE_SHIFT, y >> TILE_SHIFT);
+    return tile && tile->setSlots[SET_CANDIDATES][RUN_INDEX(x, y)] != 0;
+}
+
+// Расширение прямоугольника камней клеткой (x, y); вызывается до увеличения stones
+static inline void extendBounds(Board* b, int64_t x, int64_t y) {
+    if (b->stones == 0) {
+        b->minX = b->maxX = x;
+        b->minY = b->maxY = y;
+        return;
+    }
+    if (x < b->minX) b->minX = x;
+    if (x > b->maxX) b->maxX = x;
+    if (y < b->minY) b->minY = y;
+    if (y > b->maxY) b->maxY = y;
+}
+
+// Пересчёт прямоугольника камней по занятым плиткам (после снятия камня вне истории ходов)
+static void recomputeBounds(Board* b) {
+    int first = 1;
+    for (uint32_t i = 0; i < b->tileCount; i++) {
+        const Tile* tile = b->tiles[i];
+        if (tile->gen != b->generation || tile->stones == 0) continue;
+        uint32_t columns = 0;
+        int top = -1, bottom = -1;
+        for (int ly = 0; ly < TILE_SIZE; ly++) {
+            uint32_t row = tile->rows[0][ly] | tile->rows[1][ly];
+            if (!row) continue;
+            if (top < 0) top = ly;
+            bottom = ly;
+            columns |= row;
+        }
+        if (!columns) continue;
+        int64_t x0 = tile->tx * TILE_SIZE + __builtin_ctz(columns);
+        int64_t x1 = tile->tx * TILE_SIZE + 31 - __builtin_clz(columns);
+        int64_t y0 = tile->ty * TILE_SIZE + top, y1 = tile->ty * TILE_SIZE + bottom;
+        if (first || x0 < b->minX) b->minX = x0;
+        if (first || x1 > b->maxX) b->maxX = x1;
+        if (first || y0 < b->minY) b->minY = y0;
+        if (first || y1 > b->maxY) b->maxY = y1;
+        first = 0;
+    }
+}
+
+// Очистка клетки поля (без записи в историю ходов)
+static inline void clearCell(Board* b, int64_t x, int64_t y) {
+    Cell old = getCell(b, x, y);
+    if (old == EMPTY) return;
+    removeStone(b, old - PLAYER_X, x, y);
+    b->hash ^= zobristKey(old - PLAYER_X, x, y);
+    b->stones--;
+    recomputeBounds(b);
+}
+
+// Запись символа в клетку поля (без записи в историю ходов)
+static inline void setCell(Board* b, int64_t x, int64_t y, Cell cell) {
+    clearCell(b, x, y);
+    if (cell == EMPTY) return;
+    placeStone(b, cell - PLAYER_X, x, y);
+    b->hash ^= zobristKey(cell - PLAYER_X, x, y);
+    extendBounds(b, x, y);
+    b->stones++;
+}
+
+// Инициализация игрового поля со стороной size (0 — бесконечное; torus — свёрнутое в тор,
+// size — степень двойки) для рядов длины winLength. Плитки очищаются за O(1): достаточно
+// начать новое поколение, старые плитки будут считаться пустыми и очистятся при первой записи.
+// Упакованная копия и копия с рамкой не знают о торе, поэтому на торе не ведутся.
+void initBoard(Board* b, int64_t size, int torus, int winLength) {
+    b->size = size;
+    b->wrapMask = torus ? size - 1 : 0;
+    b->winLength = winLength;
+    initWindows(b);
+    initPackedBoard(&b->packed, torus ? 0 : size);
+    initPaddedBoard(b, torus ? 0 : size);
+    b->stones = 0;
+    b->hash = 0;
+    b->historyTop = 0;
+    b->historyLength = 0;
+    b->winLine.length = 0;
+    b->threatScore[0] = b->threatScore[1] = 0;
+    for (int set = 0; set < SET_COUNT; set++)
+        b->sets[set].count = 0;
+    if (++b->generation == 0) {
+        // Счётчик поколений переполнился: старые метки могут совпасть с новой
+        for (uint32_t i = 0; b->slots && i <= b->slotMask; i++)
+            if (b->slots[i]) b->slots[i]->gen = 0;
+        b->generation = 1;
+    }
+}
+
+// Освобождение памяти поля
+void freeBoard(Board* b) {
+    for (uint32_t i = 0; b->slots && i <= b->slotMask; i++)
+        free(b->slots[i]);
+    free(b->slots);
+    free(b->tiles);
+    free(b->history);
+    free(b->padded);
+    free(b->windowStones[0]);
+    free(b->windowStones[1]);
+    for (int set = 0; set < SET_COUNT; set++)
+        free(b->sets[set].items);
+    memset(b, 0, sizeof(*b));
+}
+
+// Ход игрока в пустую клетку с записью в стек ходов.
+// Новый ход отбрасывает отменённые ходы, которые ещё можно было повторить.
+void makeMove(Board* b, int64_t x, int64_t y, Cell player) {
+    if (b->historyTop == b->historyCapacity) {
+        int capacity = b->historyCapacity ? b->historyCapacity * 2 : 64;
+        b->history = checkedRealloc(b->history, capacity * sizeof(MoveRecord));
+        b->historyCapacity = capacity;
+    }
+
+    MoveRecord* record = &b->history[b->historyTop++];
+    record->x = x;
+    record->y = y;
+    record->player = player;
+    record->hash = b->hash;
+    record->stones = b->stones;
+    record->minX = b->minX;
+    record->minY = b->minY;
+    record->maxX = b->maxX;
+    record->maxY = b->maxY;
+    b->historyLength = b->historyTop;
+
+    placeStone(b, player - PLAYER_X, x, y);
+    b->hash ^= zobristKey(player - PLAYER_X, x, y);
+    extendBounds(b, x, y);
+    b->stones++;
+}
+
+// Отмена последнего хода за O(1): таблицы рядов пересчитываются только вдоль
+// четырёх линий через клетку, остальное состояние берётся из записи о ходе.
+// Отменённый ход остаётся за вершиной стека и может быть повторён.
+const MoveRecord* unmakeMove(Board* b) {
+    if (b->historyTop == 0) return NULL;
+    const MoveRecord* record = &b->history[--b->historyTop];
+    b->winLine.length = 0;
+    removeStone(b, record->player - PLAYER_X, record->x, record->y);
+    b->hash = record->hash;
+    b->stones = record->stones;
+    b->minX = record->minX;
+    b->minY = record->minY;
+    b->maxX = record->maxX;
+    b->maxY = record->maxY;
+    return record;
+}
+
+// Повтор последнего отменённого хода
+const MoveRecord* redoMove(Board* b) {
+    if (b->historyTop == b->historyLength) return NULL;
+    const MoveRecord* record = &b->history[b->historyTop++];
+    placeStone(b, record->player - PLAYER_X, record->x, record->y);
+    b->hash ^= zobristKey(record->player - PLAYER_X, record->x, record->y);
+    extendBounds(b, record->x, record->y);
+    b->stones++;
+    return record;
+}
+
+// Состояние генератора псевдослучайных чисел (xorshift64*)
+static uint64_t rngState = 0x2545F4914F6CDD1DULL;
+
+// Следующее псевдослучайное 64-битное число
+static inline uint64_t rng64(void) {
+    rngState ^= rngState >> 12;
+    rngState ^= rngState << 25;
+    rngState ^= rngState >> 27;
+    return rngState * 0x2545F4914F6CDD1DULL;
+}
+
+// Равномерно выбранная пустая клетка выделенных плиток за O(1).
+// Возвращает 0, если таких клеток нет.
+int randomEmptyCell(const Board* b, int64_t* x, int64_t* y) {
+    const CellSet* empty = &b->sets[SET_EMPTY];
+    if (empty->count == 0) return 0;
+    cellCoords(b, empty->items[rng64() % empty->count], x, y);
+    return 1;
+}
+
+// Запись позиции в текстовом виде. Записывается только прямоугольник, занятый
+// камнями: строка "minX minY ширина высота", затем строки из '.', 'X' и 'O'. Если
+// партия выиграна, в первую строку добавляется выигрышная линия: "x y dx dy длина игрок".
+static void writePosition(const Board* b, FILE* file) {
+    if (b->stones == 0) {
+        fprintf(file, "0 0 0 0\n");
+        return;
+    }
+    fprintf(file, "%lld %lld %lld %lld", (long long)b->minX, (long long)b->minY,
+            (long long)(b->maxX - b->minX + 1), (long long)(b->maxY - b->minY + 1));
+    const WinLine* line = &b->winLine;
+    if (line->length)
+        fprintf(file, " %lld %lld %d %d %d %c", (long long)line->x, (long long)line->y, line->dx, line->dy,
+                line->length, line->player == PLAYER_X ? 'X' : 'O');
+    fputc('\n', file);
+    for (int64_t y = b->minY; y <= b->maxY; y++) {
+        for (int64_t x = b->minX; x <= b->maxX; x++)
+            fputc(".XO"[getCell(b, x, y)], file);
+        fputc('\n', file);
+    }
+}
+
+// Чтение позиции, записанной writePosition, до конца её последней строки. История
+// ходов начинается заново; при ошибке поле остаётся пустым и возвращается 0.
+static int readPosition(Board* b, FILE* file) {
+    long long minX, minY, width, height, lineX, lineY;
+    char header[128], player;
+    int dx, dy, length;
+    // Пропуск конца предыдущей строки (заголовка файла доказательства)
+    if (fscanf(file, " ") < 0 || !fgets(header, sizeof(header), file)) return 0;
+    int fields = sscanf(header, "%lld %lld %lld %lld %lld %lld %d %d %d %c", &minX, &minY, &width, &height,
+                        &lineX, &lineY, &dx, &dy, &length, &player);
+    if (fields < 4 || width < 0 || height < 0) return 0;
+    int won = fields == 10 && (player == 'X' || player == 'O') && length > 0 &&
+              dx >= -1 && dx <= 1 && dy >= -1 && dy <= 1;
+
+    initBoard(b, b->size, b->wrapMask != 0, b->winLength);
+    for (long long y = 0; y < height; y++) {
+        for (long long x = 0; x < width; x++) {
+            int c;
+            do c = fgetc(file); while (c == '\n' || c == '\r');
+            if ((c == 'X' || c == 'O') && onBoard(b, minX + x, minY + y))
+                setCell(b, minX + x, minY + y, c == 'X' ? PLAYER_X : PLAYER_O);
+            else if (c != '.') {
+                initBoard(b, b->size, b->wrapMask != 0, b->winLength);
+                return 0;
+            }
+        }
+    }
+    if (width && height) {
+        int c;
+        while ((c = fgetc(file)) != '\n' && c != EOF) {}
+    }
+    if (won)
+        b->winLine = (WinLine){lineX, lineY, dx, dy, length, player == 'X' ? PLAYER_X : PLAYER_O};
+    return 1;
+}
+
+// Сохранение позиции в текстовый файл
+int savePosition(const Board* b, const char* path) {
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        printf("Failed to save position: %s\n", path);
+        return 0;
+    }
+    writePosition(b, file);
+    fclose(file);
+    return 1;
+}
+
+// Загрузка позиции, сохранённой savePosition
+int loadPosition(Board* b, const char* path) {
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        printf("Failed to load position: %s\n", path);
+        return 0;
+    }
+    int ok = readPosition(b, file);
+    if (!ok) printf("Invalid position file: %s\n", path);
+    fclose(file);
+    return ok;
+}
+
+// Поиск начал рядов из k единичных бит в битовом потоке: в out[i] бит p установлен,
+// если установлены биты потока с i * 64 + p по i * 64 + p + k - 1.
+// После words слов потока должно идти ещё одно (нулевое) слово.
+static void scanRunsScalar(const uint64_t* bits, uint64_t* out, size_t words, int k) {
+    for (size_t i = 0; i < words; i++) {
+        uint64_t run = bits[i];
+        for (int s = 1; s < k && run; s++)
+            run &= bits[i] >> s | bits[i + 1] << (64 - s);
+        out[i] = run;
+    }
+}
+
+#ifdef HAVE_X86_SIMD
+// То же на SSE2: по два слова за шаг
+__attribute__((target("sse2")))
+static void scanRunsSSE2(const uint64_t* bits, uint64_t* out, size_t words, int k) {
+    size_t i = 0;
+    for (; i + 2 <= words; i += 2) {
+        __m128i lo = _mm_loadu_si128((const __m128i*)(bits + i));
+        __m128i hi = _mm_loadu_si128((const __m128i*)(bits + i + 1));
+        __m128i run = lo;
+        for (int s = 1; s < k; s++) {
+            __m128i shifted = _mm_or_si128(_mm_srl_epi64(lo, _mm_cvtsi32_si128(s)),
+                                           _mm_sll_epi64(hi, _mm_cvtsi32_si128(64 - s)));
+            run = _mm_and_si128(run, shifted);
+        }
+        _mm_storeu_si128((__m128i*)(out + i), run);
+    }
+    scanRunsScalar(bits + i, out + i, words - i, k);
+}
+
+// То же на AVX2: по четыре слова за шаг
+__attribute__((target("avx2")))
+static void scanRunsAVX2(const uint64_t* bits, uint64_t* out, size_t words, int k) {
+    size_t i = 0;
+    for (; i + 4 <= words; i += 4) {
+        __m256i lo = _mm256_loadu_si256((const __m256i*)(bits + i));
+        __m256i hi = _mm256_loadu_si256((const __m256i*)(bits + i + 1));
+        __m256i run = lo;
+        for (int s = 1; s < k; s++) {
+            __m256i shifted = _mm256_or_si256(_mm256_srl_epi64(lo, _mm_cvtsi32_si128(s)),
+                                              _mm256_sll_epi64(hi, _mm_cvtsi32_si128(64 - s)));
+            run = _mm256_and_si256(run, shifted);
+        }
+        _mm256_storeu_si256((__m256i*)(out + i), run);
+    }
+    scanRunsScalar(bits + i, out + i, words - i, k);
+}
+#endif
+
+typedef void (*ScanRunsFn)(const uint64_t* bits, uint64_t* out, size_t words, int k);
+
+// Выбор ядра поиска рядов по возможностям процессора
+static ScanRunsFn selectScanRuns(void) {
+#ifdef HAVE_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return scanRunsAVX2;
+    if (__builtin_cpu_supports("sse2")) return scanRunsSSE2;
+#endif
+    return scanRunsScalar;
+}
+
+// Линии одного направления в буфере сканера
+typedef struct {
+    size_t base;    // первое слово направления в буфере
+    size_t stride;  // слов на линию, включая нулевое слово-разделитель в конце
+    int64_t lines;  // количество линий
+} ScanSection;
+
+// Запись 32 бит плитки в битовую линию начиная с бита offset
+static inline void orLineBits(uint64_t* line, int64_t offset, uint32_t word) {
+    if (offset < 0) {
+        if (offset <= -32) return;
+        word >>= -offset;
+        offset = 0;
+    }
+    int shift = offset & 63;
+    line[offset >> 6] |= (uint64_t)word << shift;
+    if (shift > 32)
+        line[(offset >> 6) + 1] |= (uint64_t)word >> (64 - shift);
+}
+
+// Поиск рядов на торе: ряд может проходить через край поля, поэтому линии
+// обходятся по клеткам с заворачиванием координат. Ряд начинается в клетке,
+// перед которой нет символа того же игрока; замкнутое кольцо начинается в столбце 0
+// (вертикальное — в строке 0).
+static int findWinningLinesTorus(const Board* b, int k, WinLine* lines, int maxLines) {
+    int found = 0;
+    int64_t n = b->size;
+    for (int64_t y = 0; y < n; y++) {
+        for (int64_t x = 0; x < n; x++) {
+            Cell player = getCell(b, x, y);
+            if (player == EMPTY) continue;
+            for (int d = 0; d < 4; d++) {
+                int dx = directions[d][0], dy = directions[d][1];
+                int length = 1;
+                while (length < n && getCell(b, x + length * dx, y + length * dy) == player)
+                    length++;
+                int ringStart = length == n && (d == 1 ? y : x) == 0;
+                if (length < k || (getCell(b, x - dx, y - dy) == player && !ringStart)) continue;
+                if (found < maxLines)
+                    lines[found] = (WinLine){x, y, dx, dy, length, player};
+                found++;
+            }
+        }
+    }
+    return found;
+}
+
+// Поиск всех рядов из k и более символов одного игрока в позиции.
+// Прямоугольник камней раскладывается в битовые строки, столбцы и диагонали
+// (каждая линия заканчивается нулевым словом, поэтому их можно сканировать
+// одним потоком), ряды ищутся SIMD-ядром, выбранным по процессору.
+// В lines записывается не больше maxLines линий; возвращается число всех найденных.
+int findWinningLines(const Board* b, int k, WinLine* lines, int maxLines) {
+    static ScanRunsFn scanRuns;
+    if (!scanRuns) scanRuns = selectScanRuns();
+    if (b->stones == 0) return 0;
+    if (b->wrapMask) return findWinningLinesTorus(b, k, lines, maxLines);
+
+    int64_t x0 = b->minX, y0 = b->minY;
+    int64_t width = b->maxX - b->minX + 1, height = b->maxY - b->minY + 1;
+    ScanSection sections[4];
+    int64_t lineCount[4] = {height, width, width + height - 1, width + height - 1};
+    int64_t lineBits[4] = {width, height, height, width};
+    size_t words = 0;
+    for (int d = 0; d < 4; d++) {
+        sections[d].base = words;
+        sections[d].stride = (lineBits[d] + 63) / 64 + 1;
+        sections[d].lines = lineCount[d];
+        words += sections[d].stride * lineCount[d];
+    }
+    uint64_t* bits = checkedRealloc(NULL, (2 * words + 1) * sizeof(uint64_t));
+    uint64_t* out = bits + words + 1;
+
+    int found = 0;
+    for (int p = 0; p < 2; p++) {
+        memset(bits, 0, (words + 1) * sizeof(uint64_t));
+
+        // Раскладка плиток по линиям
+        for (uint32_t i = 0; i < b->tileCount; i++) {
+            const Tile* tile = b->tiles[i];
+            if (tile->gen != b->generation || tile->stones == 0) continue;
+            int64_t ox = tile->tx * TILE_SIZE - x0, oy = tile->ty * TILE_SIZE - y0;
+            for (int l = 0; l < TILE_SIZE; l++) {
+                if (tile->rows[p][l] && oy + l >= 0 && oy + l < height)
+                    orLineBits(bits + sections[0].base + (oy + l) * sections[0].stride, ox, tile->rows[p][l]);
+                if (tile->cols[p][l] && ox + l >= 0 && ox + l < width)
+                    orLineBits(bits + sections[1].base + (ox + l) * sections[1].stride, oy, tile->cols[p][l]);
+            }
+            for (int t = 0; t < TILE_DIAGS; t++) {
+                // Диагональ t плитки: клетки (lx, lx - t + TILE_SIZE - 1), бит lx
+                int64_t j = ox - oy + t - (TILE_SIZE - 1) + height - 1;
+                if (tile->diags[p][t] && j >= 0 && j < sections[2].lines)
+                    orLineBits(bits + sections[2].base + j * sections[2].stride, oy - t + TILE_SIZE - 1, tile->diags[p][t]);
+                // Антидиагональ t плитки: клетки (lx, t - lx), бит lx
+                j = ox + oy + t;
+                if (tile->antiDiags[p][t] && j >= 0 && j < sections[3].lines)
+                    orLineBits(bits + sections[3].base + j * sections[3].stride, ox, tile->antiDiags[p][t]);
+            }
+        }
+
+        scanRuns(bits, out, words, k);
+
+        // Каждая группа подряд идущих начал — одна линия длиной (размер группы + k - 1)
+        for (size_t i = 0; i < words; i++) {
+            uint64_t starts = out[i] & ~(out[i] << 1 | (i > 0 ? out[i - 1] >> 63 : 0));
+            while (starts) {
+                size_t bit = i * 64 + __builtin_ctzll(starts);
+                starts &= starts - 1;
+
+                int group = 0;
+                while (bit + group < words * 64 && (out[(bit + group) >> 6] >> ((bit + group) & 63) & 1))
+                    group++;
+
+                int d = 3;
+                while (bit < sections[d].base * 64) d--;
+                size_t offset = bit - sections[d].base * 64;
+                int64_t j = offset / (sections[d].stride * 64);
+                int64_t pos = offset % (sections[d].stride * 64);
+
+                if (found < maxLines) {
+                    WinLine* line = &lines[found];
+                    switch (d) {
+                        case 0: line->x = x0 + pos; line->y = y0 + j; break;
+                        case 1: line->x = x0 + j; line->y = y0 + pos; break;
+                        case 2: line->x = x0 + j - (height - 1) + pos; line->y = y0 + pos; break;
+                        default: line->x = x0 + pos; line->y = y0 + j - pos; break;
+                    }
+                    line->dx = directions[d][0];
+                    line->dy = directions[d][1];
+                    line->length = group + k - 1;
+                    line->player = p + PLAYER_X;
+                }
+                found++;
+            }
+        }
+    }
+    free(bits);
+    return found;
+}
+
+// Проверка сохранённых позиций из командной строки: для каждого файла
+// печатаются все ряды из k и более символов
+int scanPositionFiles(int k, int count, char* paths[]) {
+    Board position = {0};
+    WinLine lines[64];
+    int status = 0;
+    for (int i = 0; i < count; i++) {
+        if (!loadPosition(&position, paths[i])) {
+            status = 1;
+            continue;
+        }
+        int found = findWinningLines(&position, k, lines, 64);
+        if (found == 0)
+            printf("%s: no winning lines\n", paths[i]);
+        for (int l = 0; l < found && l < 64; l++)
+            printf("%s: %c from (%lld, %lld) direction (%d, %d) length %d\n", paths[i],
+                   lines[l].player == PLAYER_X ? 'X' : 'O', (long long)lines[l].x, (long long)lines[l].y,
+                   lines[l].dx, lines[l].dy, lines[l].length);
+    }
+    freeBoard(&position);
+    return status;
+}
+
+// Функция отображения текста
+void renderText(SDL_Renderer* renderer, const char* message, int x, int y, SDL_Color color) {
+    TTF_Font* font = TTF_OpenFont("arial.ttf", 24);
+    if (!font) {
+        printf("Failed to load font: %s\n", TTF_GetError());
+        return;
+    }
+
+    SDL_Surface* surface = TTF_RenderText_Solid(font, message, color);
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+
+    SDL_Rect rect = {x, y, surface->w, surface->h};
+    SDL_RenderCopy(renderer, texture, NULL, &rect);
+
+    SDL_FreeSurface(surface);
+    SDL_DestroyTexture(texture);
+    TTF_CloseFont(font);
+}
+
+// Отрисовка окна с результатом игры и кнопками "Close" и "Retry"
+void drawMessageBox(SDL_Renderer* renderer, const char* message) {
+    SDL_Color bgColor = {255, 255, 255, 255};
+    SDL_Color textColor = {0, 0, 0, 255};
+
+    // Рисуем фон и рамку окна
+    SDL_SetRenderDrawColor(renderer, bgColor.r, bgColor.g, bgColor.b, bgColor.a);
+    SDL_Rect messageRect = {WINDOW_WIDTH / 4, WINDOW_HEIGHT / 3, WINDOW_WIDTH / 2, 150};
+    SDL_RenderFillRect(renderer, &messageRect);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+    SDL_RenderDrawRect(renderer, &messageRect);
+
+    renderText(renderer, message, messageRect.x + 10, messageRect.y + 20, textColor);
+
+    // Рисуем кнопки
+    SDL_Rect closeButton = {messageRect.x + 10, messageRect.y + 70, 100, 40};
+    SDL_Rect retryButton = {messageRect.x + messageRect.w - 110, messageRect.y + 70, 100, 40};
+
+    SDL_SetRenderDrawColor(renderer, 200, 0, 0, 255);
+    SDL_RenderFillRect(renderer, &closeButton);
+    renderText(renderer, "Close", closeButton.x + 10, closeButton.y + 10, textColor);
+
+    SDL_SetRenderDrawColor(renderer, 0, 200, 0, 255);
+    SDL_RenderFillRect(renderer, &retryButton);
+    renderText(renderer, "Retry", retryButton.x + 10, retryButton.y + 10, textColor);
+}
+
+// Проверка, находится ли клик внутри заданного прямоугольника
+int isClickInsideRect(SDL_Rect rect, int x, int y) {
+    return (x >= rect.x && x <= rect.x + rect.w && y >= rect.y && y <= rect.y + rect.h);
+}
+
+// Отрисовка символа игрока в клетке с экранными координатами (x, y)
+void drawStone(SDL_Renderer* renderer, Cell cell, int x, int y) {
+    if (cell == PLAYER_X) {
+        SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255);
+        SDL_RenderDrawLine(renderer, x + 10, y + 10, x + CELL_SIZE - 10, y + CELL_SIZE - 10);
+        SDL_RenderDrawLine(renderer, x + CELL_SIZE - 10, y + 10, x + 10, y + CELL_SIZE - 10);
+    } else if (cell == PLAYER_O) {
+        SDL_SetRenderDrawColor(renderer, 0, 0, 255, 255);
+        for (int angle = 0; angle < 360; angle++) {
+            int drawX = 20 * cos(angle * M_PI / 180) + x + CELL_SIZE / 2;
+            int drawY = 20 * sin(angle * M_PI / 180) + y + CELL_SIZE / 2;
+            SDL_RenderDrawPoint(renderer, drawX, drawY);
+        }
+    }
+}
+
+// Лежит ли клетка (x, y) на линии, которой закончилась партия
+int onWinLine(const Board* b, int64_t x, int64_t y) {
+    const WinLine* line = &b->winLine;
+    if (b->wrapMask) {
+        x &= b->wrapMask;
+        y &= b->wrapMask;
+    }
+    for (int t = 0; t < line->length; t++) {
+        int64_t cx = line->x + t * line->dx, cy = line->y + t * line->dy;
+        if (b->wrapMask) {
+            cx &= b->wrapMask;
+            cy &= b->wrapMask;
+        }
+        if (cx == x && cy == y) return 1;
+    }
+    return 0;
+}
+
+// Подсветка клетки выигрышной линии с экранными координатами (x, y)
+void drawWinCell(SDL_Renderer* renderer, int x, int y) {
+    SDL_Rect rect = {x + 1, y + 1, CELL_SIZE - 2, CELL_SIZE - 2};
+    SDL_SetRenderDrawColor(renderer, 170, 240, 170, 255);
+    SDL_RenderFillRect(renderer, &rect);
+}
+
+// Отрисовка игрового поля
+void drawBoard(SDL_Renderer* renderer) {
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+
+    // Рассчитываем границы видимой области
+    int64_t startX = floorDiv(cameraX, CELL_SIZE);
+    int64_t startY = floorDiv(cameraY, CELL_SIZE);
+    int64_t endX = floorDiv(cameraX + WINDOW_WIDTH, CELL_SIZE) + 1;
+    int64_t endY = floorDiv(cameraY + WINDOW_HEIGHT, CELL_SIZE) + 1;
+
+    // Конечное поле рисуем только в его границах; тор повторяется во все стороны
+    if (board.size && !board.wrapMask) {
+        if (startX < 0) startX = 0;
+        if (startY < 0) startY = 0;
+        if (endX > board.size - 1) endX = board.size - 1;
+        if (endY > board.size - 1) endY = board.size - 1;
+    }
+
+    // Сетка видимой части поля
+    for (int64_t i = startY; i <= endY; i++) {
+        for (int64_t j = startX; j <= endX; j++) {
+            SDL_Rect cellRect = { (int)(j * CELL_SIZE - cameraX), (int)(i * CELL_SIZE - cameraY), CELL_SIZE, CELL_SIZE };
+            SDL_RenderDrawRect(renderer, &cellRect);
+        }
+    }
+
+    if (board.stones == 0) return;
+
+    // Тор: каждая видимая клетка берёт символ из клетки поля с завёрнутыми координатами
+    if (board.wrapMask) {
+        for (int64_t i = startY; i <= endY; i++) {
+            for (int64_t j = startX; j <= endX; j++) {
+                int screenX = (int)(j * CELL_SIZE - cameraX), screenY = (int)(i * CELL_SIZE - cameraY);
+                if (board.winLine.length && onWinLine(&board, j, i))
+                    drawWinCell(renderer, screenX, screenY);
+                drawStone(renderer, getCell(&board, j, i), screenX, screenY);
+            }
+        }
+        return;
+    }
+
+    // Выигрышная линия берётся из результата проверки победы, поле не сканируется
+    for (int t = 0; t < board.winLine.length; t++) {
+        int64_t x = board.winLine.x + t * board.winLine.dx, y = board.winLine.y + t * board.winLine.dy;
+        if (x >= startX && x <= endX && y >= startY && y <= endY)
+            drawWinCell(renderer, (int)(x * CELL_SIZE - cameraX), (int)(y * CELL_SIZE - cameraY));
+    }
+
+    // Символы рисуем только в пересечении видимой области с прямоугольником камней,
+    // пропуская плитки без камней
+    if (startX < board.minX) startX = board.minX;
+    if (startY < board.minY) startY = board.minY;
+    if (endX > board.maxX) endX = board.maxX;
+    if (endY > board.maxY) endY = board.maxY;
+
+    for (int64_t ty = startY >> TILE_SHIFT; ty <= endY >> TILE_SHIFT; ty++) {
+        for (int64_t tx = startX >> TILE_SHIFT; tx <= endX >> TILE_SHIFT; tx++) {
+            const Tile* tile = readTile(&board, tx, ty);
+            if (!tile || tile->stones == 0) continue;
+
+            int64_t y0 = ty * TILE_SIZE > startY ? ty * TILE_SIZE : startY;
+            int64_t y1 = ty * TILE_SIZE + TILE_MASK < endY ? ty * TILE_SIZE + TILE_MASK : endY;
+            int64_t x0 = tx * TILE_SIZE > startX ? tx * TILE_SIZE : startX;
+            int64_t x1 = tx * TILE_SIZE + TILE_MASK < endX ? tx * TILE_SIZE + TILE_MASK : endX;
+            for (int64_t i = y0; i <= y1; i++) {
+                for (int64_t j = x0; j <= x1; j++) {
+                    Cell cell = getCell(&board, j, i);
+                    if (cell != EMPTY)
+                        drawStone(renderer, cell, (int)(j * CELL_SIZE - cameraX), (int)(i * CELL_SIZE - cameraY));
+                }
+            }
+        }
+    }
+}
+
+// Поклеточная проверка победы по последнему ходу игрока: каждая клетка читается из плиток
+static int checkWinTiles(const Board* b, Cell player, int64_t lastX, int64_t lastY) {
+    // Проходим по каждому направлению
+    for (int d = 0; d < 4; d++) {
+        int count = 1; // Считаем последовательно идущие символы игрока
+        int dx = directions[d][0];
+        int dy = directions[d][1];
+
+        // Проверка в одном направлении
+        for (int step = 1; step < variant->k; step++) {
+            int64_t x = lastX + step * dx;
+            int64_t y = lastY + step * dy;
+            if (getCell(b, x, y) == player) {
+                count++;
+            } else {
+                break;
+            }
+        }
+
+        // Проверка в противоположном направлении
+        for (int step = 1; step < variant->k; step++) {
+            int64_t x = lastX - step * dx;
+            int64_t y = lastY - step * dy;
+            if (getCell(b, x, y) == player) {
+                count++;
+            } else {
+                break;
+            }
+        }
+
+        // Проверка на победу
+        if (count >= variant->k) {
+            return d + 1;
+        }
+    }
+    return 0;
+}
+
+// Поклеточная проверка по копии конечного поля с рамкой: шаг вдоль линии — сдвиг
+// указателя, а рамка из WALL останавливает обход так же, как чужой символ
+static int checkWinPadded(const Board* b, Cell player, int64_t lastX, int64_t lastY) {
+    const uint8_t* center = paddedCell(b, lastX, lastY);
+    for (int d = 0; d < 4; d++) {
+        int64_t offset = b->paddedOffsets[d];
+        int count = 1;
+        for (const uint8_t* cell = center + offset; *cell == player && count < variant->k; cell += offset)
+            count++;
+        for (const uint8_t* cell = center - offset; *cell == player && count < variant->k; cell -= offset)
+            count++;
+        if (count >= variant->k)
+            return d + 1;
+    }
+    return 0;
+}
+
+// Поклеточная проверка победы по последнему ходу игрока
+int checkWinScalar(Cell player, int64_t lastX, int64_t lastY) {
+    if (board.padded)
+        return checkWinPadded(&board, player, lastX, lastY);
+    return checkWinTiles(&board, player, lastX, lastY);
+}
+
+// Замер поклеточной проверки на позиции, где все камни стоят у краёв конечного поля:
+// чтение клеток из плиток против обхода копии с рамкой
+int benchEdgeChecks(void) {
+    if (variant->size == 0 || variant->torus) {
+        printf("Benchmark needs a finite board without wrap-around\n");
+        return 1;
+    }
+    int64_t n = variant->size;
+    Board position = {0};
+    initBoard(&position, n, 0, variant->k);
+    for (int64_t y = 0; y < n; y++)
+        for (int64_t x = 0; x < n; x++)
+            if ((x < 2 || y < 2 || x >= n - 2 || y >= n - 2) && rng64() % 3)
+                setCell(&position, x, y, rng64() % 2 ? PLAYER_X : PLAYER_O);
+
+    // Проверяем клетки двух крайних рядов и столбцов за обоих игроков
+    int64_t edgeCells = n * n - (n > 4 ? (n - 4) * (n - 4) : 0);
+    int rounds = (int)(4000000 / (edgeCells * 2)) + 1;
+    long hits[2] = {0, 0};
+    double seconds[2];
+    for (int method = 0; method < 2; method++) {
+        clock_t start = clock();
+        for (int round = 0; round < rounds; round++)
+            for (int64_t y = 0; y < n; y++)
+                for (int64_t x = 0; x < n; x++) {
+                    if (x >= 2 && y >= 2 && x < n - 2 && y < n - 2) continue;
+                    for (Cell player = PLAYER_X; player <= PLAYER_O; player++)
+                        hits[method] += method == 0 ? checkWinTiles(&position, player, x, y)
+                                                    : checkWinPadded(&position, player, x, y);
+                }
+        seconds[method] = (double)(clock() - start) / CLOCKS_PER_SEC;
+    }
+
+    double checks = (double)rounds * edgeCells * 2;
+    printf("%s: %.0f edge checks, tiles %.1f ns, padded %.1f ns per check%s\n", variant->name, checks,
+           seconds[0] * 1e9 / checks, seconds[1] * 1e9 / checks, hits[0] == hits[1] ? "" : " (results differ)");
+    freeBoard(&position);
+    return hits[0] != hits[1];
+}
+
+// Размер окна линии вокруг клетки: по WINDOW_RADIUS клеток с каждой стороны
+#define WINDOW_RADIUS (MAX_WINNING_LENGTH - 1)
+#define WINDOW_BITS (2 * WINDOW_RADIUS + 1)
+#define WINDOW_MASK ((1u << WINDOW_BITS) - 1)
+
+// Окно линии направления d вокруг клетки (x, y) из битов игрока;
+// сама клетка попадает в бит WINDOW_RADIUS
+static inline uint32_t lineWindow(const Board* b, Cell player, int64_t x, int64_t y, int d) {
+    int lx = x & TILE_MASK, ly = y & TILE_MASK;
+    int insideX = lx >= WINDOW_RADIUS && lx < TILE_SIZE - WINDOW_RADIUS;
+    int insideY = ly >= WINDOW_RADIUS && ly < TILE_SIZE - WINDOW_RADIUS;
+    int p = player - PLAYER_X;
+
+    // Окно целиком лежит в одной плитке: достаточно одного слова (на торе окно
+    // может переходить через край поля, поэтому там всегда собираем по клеткам)
+    if (!b->wrapMask && ((d == 0 && insideX) || (d == 1 && insideY) || (d >= 2 && insideX && insideY))) {
+        const Tile* tile = readTile(b, x >> TILE_SHIFT, y >> TILE_SHIFT);
+        if (!tile) return 0;
+        switch (d) {
+            case 0: return (tile->rows[p][ly] >> (lx - WINDOW_RADIUS)) & WINDOW_MASK;
+            case 1: return (tile->cols[p][lx] >> (ly - WINDOW_RADIUS)) & WINDOW_MASK;
+            case 2: return (tile->diags[p][lx - ly + TILE_SIZE - 1] >> (lx - WINDOW_RADIUS)) & WINDOW_MASK;
+            default: return (tile->antiDiags[p][lx + ly] >> (lx - WINDOW_RADIUS)) & WINDOW_MASK;
+        }
+    }
+
+    // Окно пересекает границу плиток: собираем его по клеткам
+    uint32_t w = 0;
+    for (int t = -WINDOW_RADIUS; t <= WINDOW_RADIUS; t++)
+        if (getCell(b, x + t * directions[d][0], y + t * directions[d][1]) == player)
+            w |= 1u << (t + WINDOW_RADIUS);
+    return w;
+}
+
+// Есть ли в окне ряд из k подряд идущих бит, проходящий через центр
+static inline int windowHasRun(uint32_t w, int k) {
+    uint32_t run = w;
+    for (int i = 1; i < k; i++)
+        run &= w >> i; // b & (b >> 1) & ... & (b >> (k - 1))
+    return ((run >> (WINDOW_RADIUS - k + 1)) & ((1u << k) - 1)) != 0;
+}
+
+// Проверка на битбордах: привёл бы символ игрока в клетке (x, y) к победе.
+// Клетку не изменяем, центр окна просто считаем занятым игроком.
+int wouldWinBitboard(const Board* b, Cell player, int64_t x, int64_t y) {
+    for (int d = 0; d < 4; d++) {
+        uint32_t w = lineWindow(b, player, x, y, d) | (1u << WINDOW_RADIUS);
+        if (windowHasRun(w, variant->k))
+            return d + 1;
+    }
+    return 0;
+}
+
+// Проверка по таблицам рядов: привёл бы символ игрока в клетке (x, y) к ряду из k
+static inline __attribute__((always_inline)) int wouldWinRuns(const Board* b, Cell player, int64_t x, int64_t y, int k) {
+    for (int d = 0; d < 4; d++)
+        if (lineLength(b, player, x, y, d) >= k)
+            return d + 1;
+    return 0;
+}
+
+// Проверка на поле из одной плитки (size <= TILE_SIZE): клетки за краем поля
+// всегда пусты, поэтому каждая линия читается одним словом плитки (0, 0)
+// без поиска плиток и проверок границ
+static inline __attribute__((always_inline)) int wouldWinSmall(const Board* b, Cell player, int64_t x, int64_t y, int k) {
+    const Tile* tile = readTile(b, 0, 0);
+    if (!tile) return 0;
+    int p = player - PLAYER_X, lx = (int)x, ly = (int)y;
+    uint64_t lines[4] = {
+        tile->rows[p][ly] | 1u << lx,
+        tile->cols[p][lx] | 1u << ly,
+        tile->diags[p][lx - ly + TILE_SIZE - 1] | 1u << lx,
+        tile->antiDiags[p][lx + ly] | 1u << lx,
+    };
+    int shifts[4] = {lx, ly, lx, lx};
+    for (int d = 0; d < 4; d++) {
+        // Окно из 2k - 1 клеток с клеткой (x, y) в бите k - 1
+        uint64_t w = (lines[d] << (k - 1)) >> shifts[d];
+        uint64_t run = w;
+        for (int i = 1; i < k; i++)
+            run &= w >> i;
+        if (run & ((1u << k) - 1))
+            return d + 1;
+    }
+    return 0;
+}
+
+// Проверка на торе со стороной n (степень двойки, не больше TILE_SIZE): координаты
+// шагов вдоль линии заворачиваются маской n - 1, поэтому ряд может проходить через край
+static inline __attribute__((always_inline)) int wouldWinTorus(const Board* b, Cell player, int64_t x, int64_t y, int k, int n) {
+    const Tile* tile = readTile(b, 0, 0);
+    if (!tile) return 0;
+    const uint32_t* rows = tile->rows[player - PLAYER_X];
+    const int mask = n - 1;
+    for (int d = 0; d < 4; d++) {
+        int count = 1;
+        for (int step = 1; step < k; step++, count++) {
+            int cx = (int)(x + step * directions[d][0]) & mask, cy = (int)(y + step * directions[d][1]) & mask;
+            if (!(rows[cy] >> cx & 1)) break;
+        }
+        for (int step = 1; step < k; step++, count++) {
+            int cx = (int)(x - step * directions[d][0]) & mask, cy = (int)(y - step * directions[d][1]) & mask;
+            if (!(rows[cy] >> cx & 1)) break;
+        }
+        if (count >= k)
+            return d + 1;
+    }
+    return 0;
+}
+
+// Перебор клеток, где у игрока по индексу угроз получается ряд, с проверкой победы
+// wouldWinFn (она отсеивает длинные ряды там, где они не выигрывают)
+static inline __attribute__((always_inline)) int findWinningMoveWith(const Board* b, Cell player, int64_t* x, int64_t* y,
+        int (*wouldWinFn)(const Board*, Cell, int64_t, int64_t)) {
+    const CellSet* fives = &b->sets[threatSet(player - PLAYER_X, SHAPE_FIVE)];
+    for (uint32_t i = 0; i < fives->count; i++) {
+        cellCoords(b, fives->items[i], x, y);
+        if (wouldWinFn(b, player, *x, *y))
+            return 1;
+    }
+    return 0;
+}
+
+// Сдвиг упакованного поля к старшим битам: клетка переходит в клетку на s дальше
+static inline __attribute__((always_inline)) void packedShiftUp(uint64_t* out, const uint64_t* a, int s, int words) {
+    for (int i = words - 1; i >= 0; i--)
+        out[i] = a[i] << s | (i > 0 ? a[i - 1] >> (64 - s) : 0);
+}
+
+// Сдвиг упакованного поля к младшим битам
+static inline __attribute__((always_inline)) void packedShiftDown(uint64_t* out, const uint64_t* a, int s, int words) {
+    for (int i = 0; i < words; i++)
+        out[i] = a[i] >> s | (i + 1 < words ? a[i + 1] << (64 - s) : 0);
+}
+
+// Пустые клетки, ход в которые даёт игроку p ряд из k: по каждому направлению
+// before[m] — клетки, перед которыми стоят m его символов подряд, after[m] — после
+// которых; клетка выигрывает, если before[m] & after[k - 1 - m] для какого-то m
+static inline __attribute__((always_inline)) void packedWinningCells(const PackedBoard* pb, int p, uint64_t* out,
+        int k, int stride, int words) {
+    const int steps[4] = {1, stride, stride + 1, stride - 1};
+    uint64_t before[MAX_WINNING_LENGTH][PACKED_WORDS], after[MAX_WINNING_LENGTH][PACKED_WORDS];
+    uint64_t up[PACKED_WORDS], down[PACKED_WORDS];
+    for (int i = 0; i < words; i++)
+        out[i] = 0;
+    for (int d = 0; d < 4; d++) {
+        for (int i = 0; i < words; i++) {
+            before[0][i] = after[0][i] = ~0ull;
+            up[i] = down[i] = pb->stones[p][i];
+        }
+        for (int m = 1; m < k; m++) {
+            packedShiftUp(up, up, steps[d], words);
+            packedShiftDown(down, down, steps[d], words);
+            for (int i = 0; i < words; i++) {
+                before[m][i] = before[m - 1][i] & up[i];
+                after[m][i] = after[m - 1][i] & down[i];
+            }
+        }
+        for (int m = 0; m < k; m++)
+            for (int i = 0; i < words; i++)
+                out[i] |= before[m][i] & after[k - 1 - m][i];
+    }
+    for (int i = 0; i < words; i++)
+        out[i] &= pb->valid[i] & ~(pb->stones[0][i] | pb->stones[1][i]);
+}
+
+// Поиск выигрышного хода по упакованному полю: все клетки проверяются сразу
+static inline __attribute__((always_inline)) int findWinningMovePacked(const Board* b, Cell player, int64_t* x, int64_t* y,
+        int k, int n) {
+    const int stride = n + 1, words = (n * stride + 63) / 64;
+    uint64_t cells[PACKED_WORDS];
+    packedWinningCells(&b->packed, player - PLAYER_X, cells, k, stride, words);
+    for (int i = 0; i < words; i++) {
+        if (!cells[i]) continue;
+        int bit = i * 64 + __builtin_ctzll(cells[i]);
+        *x = bit % stride;
+        *y = bit / stride;
+        return 1;
+    }
+    return 0;
+}
+
+// Случайная пустая клетка рядом (в том числе по диагонали) с каким-либо камнем
+// упакованного поля; 0, если таких клеток нет
+int randomPackedNeighbor(const PackedBoard* pb, int64_t* x, int64_t* y) {
+    uint64_t occupied[PACKED_WORDS], row[PACKED_WORDS], shifted[PACKED_WORDS], near[PACKED_WORDS];
+    int count = 0;
+    if (!pb->words) return 0;
+    for (int i = 0; i < pb->words; i++)
+        occupied[i] = row[i] = pb->stones[0][i] | pb->stones[1][i];
+    packedShiftUp(shifted, occupied, 1, pb->words);
+    for (int i = 0; i < pb->words; i++) row[i] |= shifted[i];
+    packedShiftDown(shifted, occupied, 1, pb->words);
+    for (int i = 0; i < pb->words; i++) near[i] = row[i] |= shifted[i];
+    packedShiftUp(shifted, row, pb->stride, pb->words);
+    for (int i = 0; i < pb->words; i++) near[i] |= shifted[i];
+    packedShiftDown(shifted, row, pb->stride, pb->words);
+    for (int i = 0; i < pb->words; i++) {
+        near[i] = (near[i] | shifted[i]) & pb->valid[i] & ~occupied[i];
+        count += __builtin_popcountll(near[i]);
+    }
+    if (count == 0) return 0;
+
+    int target = (int)(rng64() % count);
+    for (int i = 0; i < pb->words; i++) {
+        int inWord = __builtin_popcountll(near[i]);
+        if (target >= inWord) {
+            target -= inWord;
+            continue;
+        }
+        uint64_t word = near[i];
+        while (target--) word &= word - 1;
+        int bit = i * 64 + __builtin_ctzll(word);
+        *x = bit % pb->stride;
+        *y = bit / pb->stride;
+        return 1;
+    }
+    return 0;
+}
+
+// Специализации под вариант игры (K подряд на поле N x N, N = 0 — бесконечное поле):
+// длина ряда и размер поля становятся константами, циклы разворачиваются компилятором,
+// поле из одной плитки читается напрямую, а поле, помещающееся в PACKED_BITS,
+// проверяется сдвигами упакованной копии целиком
+#define DEFINE_VARIANT_KERNELS(K, N) \
+    static int wouldWin_##K##_##N(const Board* b, Cell player, int64_t x, int64_t y) { \
+        return (N) > 0 && (N) <= TILE_SIZE ? wouldWinSmall(b, player, x, y, K) : wouldWinRuns(b, player, x, y, K); \
+    } \
+    static int findWinningMove_##K##_##N(const Board* b, Cell player, int64_t* x, int64_t* y) { \
+        /* Индекс угроз за O(1) отвечает, что выигрышных клеток нет */ \
+        if (b->sets[threatSet(player - PLAYER_X, SHAPE_FIVE)].count == 0) return 0; \
+        if ((N) > 0 && (N) * ((N) + 1) <= PACKED_BITS) \
+            return findWinningMovePacked(b, player, x, y, K, (N) > 0 ? (N) : 1); \
+        return findWinningMoveWith(b, player, x, y, wouldWin_##K##_##N); \
+    }
+
+DEFINE_VARIANT_KERNELS(5, 0)
+DEFINE_VARIANT_KERNELS(3, 3)
+DEFINE_VARIANT_KERNELS(4, 7)
+DEFINE_VARIANT_KERNELS(5, 15)
+DEFINE_VARIANT_KERNELS(5, 19)
+DEFINE_VARIANT_KERNELS(6, 0)
+
+// Специализации для тора N x N: N — степень двойки, весь тор лежит в плитке (0, 0)
+#define DEFINE_TORUS_KERNELS(K, N) \
+    _Static_assert(((N) & ((N) - 1)) == 0 && (N) >= (K) && (N) <= TILE_SIZE, "torus size"); \
+    static int wouldWinTorus_##K##_##N(const Board* b, Cell player, int64_t x, int64_t y) { \
+        return wouldWinTorus(b, player, x, y, K, N); \
+    } \
+    static int findWinningMoveTorus_##K##_##N(const Board* b, Cell player, int64_t* x, int64_t* y) { \
+        return findWinningMoveWith(b, player, x, y, wouldWinTorus_##K##_##N); \
+    }
+
+DEFINE_TORUS_KERNELS(5, 16)
+DEFINE_TORUS_KERNELS(5, 32)
+
+#define VARIANT(name, K, N) {name, K, N, 0, wouldWin_##K##_##N, findWinningMove_##K##_##N}
+#define TORUS_VARIANT(name, K, N) {name, K, N, 1, wouldWinTorus_##K##_##N, findWinningMoveTorus_##K##_##N}
+
+// Варианты игры; первый используется по умолчанию
+static const Variant variants[] = {
+    VARIANT("infinite", 5, 0),
+    VARIANT("3x3", 3, 3),
+    VARIANT("7x7", 4, 7),
+    VARIANT("15x15", 5, 15),
+    VARIANT("19x19", 5, 19),
+    VARIANT("connect6", 6, 0),
+    TORUS_VARIANT("torus16", 5, 16),
+    TORUS_VARIANT("torus32", 5, 32),
+};
+
+// Выбор варианта по имени; NULL, если такого нет
+const Variant* findVariant(const char* name) {
+    for (size_t i = 0; i < sizeof(variants) / sizeof(variants[0]); i++)
+        if (strcmp(variants[i].name, name) == 0)
+            return &variants[i];
+    return NULL;
+}
+
+// Свободные правила: побеждает ряд из k и более символов.
+// Для сравнения флагами компиляции можно включить поклеточную проверку
+// (-DSCALAR_WIN_CHECK) или проверку на битбордах (-DBITBOARD_WIN_CHECK).
+static int wouldWinFreestyle(const Board* b, Cell player, int64_t x, int64_t y) {
+#if defined(SCALAR_WIN_CHECK)
+    // Поклеточная проверка не читает саму клетку, поэтому ставить символ не нужно
+    return b->padded ? checkWinPadded(b, player, x, y) : checkWinTiles(b, player, x, y);
+#elif defined(BITBOARD_WIN_CHECK)
+    return wouldWinBitboard(b, player, x, y);
+#else
+    return variant->wouldWin(b, player, x, y);
+#endif
+}
+
+static int findWinningMoveFreestyle(const Board* b, Cell player, int64_t* x, int64_t* y) {
+#if defined(SCALAR_WIN_CHECK) || defined(BITBOARD_WIN_CHECK)
+    return findWinningMoveWith(b, player, x, y, wouldWinFreestyle);
+#else
+    return variant->findWinningMove(b, player, x, y);
+#endif
+}
+
+// Длина ряда игрока через клетку (x, y) по направлению d, если поставить туда его символ
+static inline int runLength(const Board* b, Cell player, int64_t x, int64_t y, int d) {
+    if (!b->wrapMask)
+        return lineLength(b, player, x, y, d);
+    // Таблицы рядов не знают о торе: считаем по клеткам
+    int length = 1;
+    for (int sign = -1; sign <= 1; sign += 2)
+        for (int step = 1; step < b->size && getCell(b, x + sign * step * directions[d][0], y + sign * step * directions[d][1]) == player; step++)
+            length++;
+    return length;
+}
+
+// Победа ровно k символами подряд: длинный ряд не выигрывает
+static inline int makesExactRun(const Board* b, Cell player, int64_t x, int64_t y, int k) {
+    for (int d = 0; d < 4; d++)
+        if (runLength(b, player, x, y, d) == k)
+            return d + 1;
+    return 0;
+}
+
+// Стандартные правила: побеждает ровно k в ряд
+static int wouldWinStandard(const Board* b, Cell player, int64_t x, int64_t y) {
+    return makesExactRun(b, player, x, y, variant->k);
+}
+
+static int findWinningMoveStandard(const Board* b, Cell player, int64_t* x, int64_t* y) {
+    return findWinningMoveWith(b, player, x, y, wouldWinStandard);
+}
+
+// Рэндзю: чёрные (X) выигрывают ровно пятью, белые (O) — пятью и более
+static int wouldWinRenju(const Board* b, Cell player, int64_t x, int64_t y) {
+    return player == PLAYER_X ? makesExactRun(b, player, x, y, 5) : variant->wouldWin(b, player, x, y);
+}
+
+static int findWinningMoveRenju(const Board* b, Cell player, int64_t* x, int64_t* y) {
+    return player == PLAYER_X ? findWinningMoveWith(b, player, x, y, wouldWinRenju)
+                              : variant->findWinningMove(b, player, x, y);
+}
+
+// Свойства линии после хода чёрных в центр в таблице renjuPatterns
+enum {
+    LINE_FIVE = 1,        // ровно пять в ряд
+    LINE_OVERLINE = 2,    // шесть и более в ряд
+    LINE_THREE = 4,       // открытая тройка: ещё одним ходом получается открытая четвёрка
+    LINE_FOURS_SHIFT = 3, // биты 3-4 — количество четвёрок (одна линия может дать две)
+};
+
+// Клетки окна линии направления d вокруг (x, y), лежащие за краем конечного поля
+static inline uint32_t offBoardWindow(const Board* b, int64_t x, int64_t y, int d) {
+    if (!b->size || b->wrapMask) return 0;
+    if (x >= PATTERN_RADIUS && y >= PATTERN_RADIUS && x < b->size - PATTERN_RADIUS && y < b->size - PATTERN_RADIUS)
+        return 0;
+    uint32_t w = 0;
+    for (int t = -PATTERN_RADIUS; t <= PATTERN_RADIUS; t++)
+        if (!onBoard(b, x + t * directions[d][0], y + t * directions[d][1]))
+            w |= 1u << (t + PATTERN_RADIUS);
+    return w;
+}
+
+// Свойства линии направления d после хода чёрных в клетку (x, y): одно чтение таблицы
+static inline uint8_t renjuLine(const Board* b, int64_t x, int64_t y, int d) {
+    uint32_t own = lineWindow(b, PLAYER_X, x, y, d);
+    uint32_t blocked = lineWindow(b, PLAYER_O, x, y, d) | offBoardWindow(b, x, y, d);
+    const uint32_t sideMask = (1u << PATTERN_RADIUS) - 1;
+    int left = patternSide(reversed5[own & sideMask], reversed5[blocked & sideMask]);
+    int right = patternSide(own >> (PATTERN_RADIUS + 1), blocked >> (PATTERN_RADIUS + 1));
+    return renjuPatterns[left * PATTERN_SIDE + right];
+}
+
+// Запрещённые ходы чёрных в рэндзю: две открытые тройки, две четвёрки или длинный ряд.
+// Ход, дающий ровно пять, разрешён всегда. Тройки определяются по одной линии,
+// без проверки, не запрещён ли сам ход, превращающий их в открытую четвёрку.
+static int isForbiddenRenju(const Board* b, Cell player, int64_t x, int64_t y) {
+    if (player != PLAYER_X) return 0;
+    int threes = 0, fours = 0, overline = 0;
+    for (int d = 0; d < 4; d++) {
+        uint8_t line = renjuLine(b, x, y, d);
+        if (line & LINE_FIVE) return 0;
+        overline |= line & LINE_OVERLINE;
+        threes += (line & LINE_THREE) != 0;
+        fours += line >> LINE_FOURS_SHIFT;
+    }
+    return overline || threes >= 2 || fours >= 2;
+}
+
+// Наборы правил; первый используется по умолчанию
+static const RuleSet ruleSets[] = {
+    {"freestyle", wouldWinFreestyle, findWinningMoveFreestyle, NULL, 0},
+    {"standard", wouldWinStandard, findWinningMoveStandard, NULL, 1 << PLAYER_X | 1 << PLAYER_O},
+    {"renju", wouldWinRenju, findWinningMoveRenju, isForbiddenRenju, 1 << PLAYER_X},
+};
+
+// Выбор правил по имени; NULL, если таких нет
+const RuleSet* findRuleSet(const char* name) {
+    for (size_t i = 0; i < sizeof(ruleSets) / sizeof(ruleSets[0]); i++)
+        if (strcmp(ruleSets[i].name, name) == 0)
+            return &ruleSets[i];
+    return NULL;
+}
+
+// Выигрывает ли найденная линия по текущим правилам
+int lineWins(const WinLine* line) {
+    return line->length == variant->k || (line->length > variant->k && !(rules->exactPlayers >> line->player & 1));
+}
+
+// Можно ли игроку ходить в клетку (x, y): она на поле, пуста и не запрещена правилами
+int isLegalMove(const Board* b, Cell player, int64_t x, int64_t y) {
+    if (!onBoard(b, x, y) || getCell(b, x, y) != EMPTY) return 0;
+    return !rules->isForbidden || !rules->isForbidden(b, player, x, y);
+}
+
+// Выигрышная линия игрока через клетку (x, y) по направлению d. Концы ряда берутся
+// из таблиц рядов (на торе — обходом клеток), поле заново не сканируется.
+static void describeWinLine(const Board* b, Cell player, int64_t x, int64_t y, int d, WinLine* line) {
+    int dx = directions[d][0], dy = directions[d][1];
+    int before = 0, after = 0;
+    if (b->wrapMask) {
+        while (before + 1 < b->size && getCell(b, x - (before + 1) * dx, y - (before + 1) * dy) == player) before++;
+        while (before + after + 1 < b->size && getCell(b, x + (after + 1) * dx, y + (after + 1) * dy) == player) after++;
+    } else {
+        const Tile* tile = readTile(b, x >> TILE_SHIFT, y >> TILE_SHIFT);
+        uint8_t run = tile ? tile->runs[player - PLAYER_X][d][RUN_INDEX(x, y)] : 0;
+        before = run & 15;
+        after = run >> 4;
+    }
+    line->x = x - before * dx;
+    line->y = y - before * dy;
+    if (b->wrapMask) {
+        line->x &= b->wrapMask;
+        line->y &= b->wrapMask;
+    }
+    line->dx = dx;
+    line->dy = dy;
+    line->length = before + after + 1;
+    line->player = player;
+}
+
+// Проверка победы по последнему ходу игрока по текущим правилам.
+// Детектор и так знает направление ряда, поэтому выигрышная линия
+// записывается в line (если он не NULL) почти бесплатно.
+int checkWin(Cell player, int64_t lastX, int64_t lastY, WinLine* line) {
+    int d = rules->wouldWin(&board, player, lastX, lastY);
+    if (d && line)
+        describeWinLine(&board, player, lastX, lastY, d - 1, line);
+    return d != 0;
+}
+
+// Поиск хода: негамакс с альфа-бета отсечением, поиском с нулевым окном (PVS)
+// и итеративным углублением. Позиция меняется через makeMove/unmakeMove, а ходы
+// берутся из множества кандидатов рядом с камнями, так что размер поля не важен.
+#define SCORE_WIN 1000000      // выигрыш через ply ходов оценивается как SCORE_WIN - ply
+#define SCORE_INFINITY (SCORE_WIN + 1)
+#define SEARCH_MAX_DEPTH 32
+#define SEARCH_BRANCH 12       // сколько лучших по угрозам ходов перебирается во внутренних узлах
+#define SEARCH_ROOT_BRANCH 24  // и в корне
+// Время на ход компьютера, мс
+#define AI_THINK_MILLIS 400
+
+// Ограничения поиска; 0 — без ограничения
+typedef struct {
+    int maxDepth;
+    uint64_t maxNodes;
+    uint32_t millis;
+} SearchLimits;
+
+// Результат поиска: лучший ход и его оценка для ходящего игрока
+typedef struct {
+    int found;       // 0 — ходов нет
+    int64_t x, y;
+    int score;
+    int depth;       // глубина последней завершённой итерации
+    uint64_t nodes;
+} SearchResult;
+
+// Состояние одного поиска
+typedef struct {
+    Board* b;
+    SearchLimits limits;
+    uint32_t start;  // SDL_GetTicks() в начале поиска
+    uint64_t nodes;
+    int stopped;     // исчерпан бюджет: результаты текущей итерации неполны
+    uint64_t probes, hits, stores;  // обращения к таблице транспозиций; сливаются в tt в конце поиска
+    struct VctSearch* vct;          // продление листьев поиском угроз (NULL — без него)
+} Search;
+
+// Таблица транспозиций: корзины размером в строку кэша по TT_ENTRIES записей из двух
+// слов. Первое слово — ключ, сложенный по XOR с данными, поэтому запись, которую
+// другой поток успел переписать лишь наполовину, не пройдёт проверку ключа. Так
+// таблицу делят потоки поиска без блокировок. Вытесняется самая мелкая запись,
+// причём каждый пропущенный поиск делает запись «мельче» на TT_AGE_PENALTY.
+#define TT_ENTRIES 4
+#define TT_DEFAULT_MB 64
+#define TT_AGE_PENALTY 8
+#define TT_HUGE_PAGE (2 << 20)
+// Оценки выигрыша, которые хранятся относительно узла, а не корня
+#define SCORE_DECIDED (SCORE_WIN - 1000)
+
+typedef struct {
+    uint64_t words[TT_ENTRIES][2];  // ключ ^ данные, данные
+} __attribute__((aligned(64))) TTBucket;
+
+// Граница оценки в записи; 0 — запись пуста
+enum { TT_EXACT = 1, TT_LOWER, TT_UPPER };
+
+typedef struct {
+    TTBucket* buckets;
+    uint64_t bucketMask;
+    void* memory;          // выделенная память и её размер
+    size_t memorySize;
+    int mapped;            // память получена через mmap (с просьбой о больших страницах)
+    uint32_t age;          // номер поиска по модулю 32
+    uint64_t probes, hits, stores;
+} TranspositionTable;
+
+TranspositionTable tt;
+
+// Запись таблицы в распакованном виде
+typedef struct {
+    int score, depth, bound;
+    uint32_t age;
+    int hasMove;
+    uint32_t moveX, moveY;  // младшие TT_MOVE_BITS бит координат лучшего хода
+} TTEntry;
+
+// Данные записи: оценка со смещением (21 бит), глубина (6), граница (2), возраст (5),
+// признак хода (1) и младшие биты координат лучшего хода (по 14)
+#define TT_MOVE_BITS 14
+#define TT_MOVE_MASK ((1u << TT_MOVE_BITS) - 1)
+
+static inline uint64_t ttPack(const TTEntry* e) {
+    return (uint64_t)(e->score + (1 << 20)) | (uint64_t)e->depth << 21 | (uint64_t)e->bound << 27 |
+           (uint64_t)(e->age & 31) << 29 | (uint64_t)e->hasMove << 34 |
+           (uint64_t)(e->moveX & TT_MOVE_MASK) << 35 | (uint64_t)(e->moveY & TT_MOVE_MASK) << 49;
+}
+
+static inline void ttUnpack(uint64_t data, TTEntry* e) {
+    e->score = (int)(data & ((1u << 21) - 1)) - (1 << 20);
+    e->depth = data >> 21 & 63;
+    e->bound = data >> 27 & 3;
+    e->age = data >> 29 & 31;
+    e->hasMove = data >> 34 & 1;
+    e->moveX = data >> 35 & TT_MOVE_MASK;
+    e->moveY = data >> 49 & TT_MOVE_MASK;
+}
+
+// Выделение таблицы размером megabytes МБ (округляется вниз до степени двойки корзин).
+// hugePages — попросить у Linux большие страницы; где их нет, память выделяется обычно.
+void ttInit(TranspositionTable* t, size_t megabytes, int hugePages) {
+    size_t buckets = 1;
+    while (buckets * 2 * sizeof(TTBucket) <= megabytes << 20) buckets *= 2;
+    t->memorySize = buckets * sizeof(TTBucket);
+    t->memory = NULL;
+    t->mapped = 0;
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (hugePages) {
+        t->memorySize = (t->memorySize + TT_HUGE_PAGE - 1) & ~(size_t)(TT_HUGE_PAGE - 1);
+        void* memory = mmap(NULL, t->memorySize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memory != MAP_FAILED) {
+            madvise(memory, t->memorySize, MADV_HUGEPAGE);
+            t->memory = memory;
+            t->mapped = 1;
+        } else {
+            printf("Huge pages unavailable, using regular memory\n");
+        }
+    }
+#else
+    if (hugePages) printf("Huge pages unavailable, using regular memory\n");
+#endif
+    if (!t->memory) t->memory = checkedCalloc(1, t->memorySize + sizeof(TTBucket));
+    t->buckets = (TTBucket*)(((uintptr_t)t->memory + sizeof(TTBucket) - 1) & ~(uintptr_t)(sizeof(TTBucket) - 1));
+    t->bucketMask = buckets - 1;
+    t->age = 0;
+    t->probes = t->hits = t->stores = 0;
+}
+
+void ttFree(TranspositionTable* t) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (t->mapped) munmap(t->memory, t->memorySize);
+    else
+#endif
+        free(t->memory);
+    memset(t, 0, sizeof(*t));
+}
+
+// Поиск записи позиции с ключом key
+static inline int ttProbe(const TranspositionTable* t, uint64_t key, TTEntry* e) {
+    if (!t->buckets) return 0;
+    const TTBucket* bucket = &t->buckets[key & t->bucketMask];
+    for (int i = 0; i < TT_ENTRIES; i++) {
+        uint64_t check = __atomic_load_n(&bucket->words[i][0], __ATOMIC_RELAXED);
+        uint64_t data = __atomic_load_n(&bucket->words[i][1], __ATOMIC_RELAXED);
+        if ((check ^ data) == key && (data >> 27 & 3)) {
+            ttUnpack(data, e);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Запись позиции: поверх своей же старой записи или вместо самой мелкой с учётом возраста
+static inline void ttStore(TranspositionTable* t, uint64_t key, TTEntry* e) {
+    if (!t->buckets) return;
+    TTBucket* bucket = &t->buckets[key & t->bucketMask];
+    int victim = 0, victimValue = INT32_MAX;
+    e->age = t->age;
+    for (int i = 0; i < TT_ENTRIES; i++) {
+        uint64_t check = __atomic_load_n(&bucket->words[i][0], __ATOMIC_RELAXED);
+        uint64_t data = __atomic_load_n(&bucket->words[i][1], __ATOMIC_RELAXED);
+        if ((check ^ data) == key) {
+            // Та же позиция: сохраняем известный лучший ход, если нового нет
+            if (!e->hasMove && (data >> 34 & 1)) {
+                e->hasMove = 1;
+                e->moveX = data >> 35 & TT_MOVE_MASK;
+                e->moveY = data >> 49 & TT_MOVE_MASK;
+            }
+            victim = i;
+            break;
+        }
+        int value = (data >> 27 & 3) ? (int)(data >> 21 & 63) - TT_AGE_PENALTY * (int)((t->age - (data >> 29 & 31)) & 31) : -1000;
+        if (value < victimValue) {
+            victimValue = value;
+            victim = i;
+        }
+    }
+    uint64_t data = ttPack(e);
+    __atomic_store_n(&bucket->words[victim][1], data, __ATOMIC_RELAXED);
+    __atomic_store_n(&bucket->words[victim][0], key ^ data, __ATOMIC_RELAXED);
+}
+
+// Доля занятых записей (в процентах) по первым корзинам таблицы
+static double ttFill(const TranspositionTable* t) {
+    uint64_t sample = t->bucketMask + 1 < 1000 ? t->bucketMask + 1 : 1000, used = 0;
+    for (uint64_t i = 0; i < sample; i++)
+        for (int j = 0; j < TT_ENTRIES; j++)
+            used += (t->buckets[i].words[j][1] >> 27 & 3) != 0;
+    return 100.0 * used / (sample * TT_ENTRIES);
+}
+
+// Статистика таблицы: размер, доля попаданий и заполненность
+void ttPrintStats(const TranspositionTable* t) {
+    if (!t->buckets) return;
+    printf("Transposition table: %zu MB, %llu probes, hit rate %.1f%%, %llu stores, filled %.1f%%\n",
+           (size_t)((t->bucketMask + 1) * sizeof(TTBucket) >> 20), (unsigned long long)t->probes,
+           t->probes ? 100.0 * t->hits / t->probes : 0.0, (unsigned long long)t->stores, ttFill(t));
+}
+
+// Ключ позиции для таблицы: ключ Зобриста поля и очередь хода
+static inline uint64_t searchKey(const Board* b, Cell player) {
+    return b->hash ^ (player == PLAYER_O ? 0xD6E8FEB86659FD93ULL : 0);
+}
+
+// Оценки выигрыша в таблице отсчитываются от узла, а в поиске — от корня
+static inline int scoreToTable(int score, int ply) {
+    return score >= SCORE_DECIDED ? score + ply : score <= -SCORE_DECIDED ? score - ply : score;
+}
+
+static inline int scoreFromTable(int score, int ply) {
+    return score >= SCORE_DECIDED ? score - ply : score <= -SCORE_DECIDED ? score + ply : score;
+}
+
+// Ход-кандидат с оценкой для упорядочивания
+typedef struct {
+    uint32_t ref;    // ссылка на клетку, как в CellSet
+    int score;
+} ScoredMove;
+
+// Ходы игрока, упорядоченные по угрозам: свои фигуры весят вдвое больше чужих.
+// Если соперник грозит выиграть следующим ходом, остаются только защиты.
+// Возвращает количество ходов (не больше max).
+static int generateMoves(const Board* b, Cell player, ScoredMove* moves, int max) {
+    int p = player - PLAYER_X, count = 0;
+    const CellSet* cells = &b->sets[SET_CANDIDATES];
+    int64_t x, y;
+    if (rules->findWinningMove(b, PLAYER_X + PLAYER_O - player, &x, &y))
+        cells = &b->sets[threatSet(!p, SHAPE_FIVE)];
+
+    for (uint32_t i = 0; i < cells->count; i++) {
+        uint32_t ref = cells->items[i];
+        const Tile* tile = b->tiles[ref >> (2 * TILE_SHIFT)];
+        int local = ref & (TILE_CELLS - 1), score = 0;
+        for (int d = 0; d < 4; d++)
+            score += 2 * shapeWeights[tile->shapes[p][d][local]] + shapeWeights[tile->shapes[!p][d][local]];
+        // Равные по оценке ходы упорядочены по ссылке: порядок не зависит от того,
+        // как множество кандидатов менялось по пути к позиции
+        if (count == max && (score < moves[count - 1].score || (score == moves[count - 1].score && ref > moves[count - 1].ref)))
+            continue;
+        int j = count < max ? count++ : count - 1;
+        for (; j > 0 && (moves[j - 1].score < score || (moves[j - 1].score == score && moves[j - 1].ref > ref)); j--)
+            moves[j] = moves[j - 1];
+        moves[j].ref = ref;
+        moves[j].score = score;
+    }
+    return count;
+}
+
+// Поиск выигрыша сплошными четвёрками (VCF): атакующий ходит только так, чтобы
+// получить четвёрку, и у защитника остаётся единственный ответ — закрыть её.
+// Ходы берутся из множеств угроз, поэтому узел стоит пары ходов и чтений множеств.
+#define VCF_MAX_DEPTH 24          // сколько четвёрок подряд может поставить атакующий
+#define VCF_MAX_MOVES (2 * VCF_MAX_DEPTH + 1)
+#define VCF_MAX_BRANCH 32
+#define VCF_HASH_BITS 16
+// Бюджет узлов на поиск за компьютер и на подсказку игроку
+#define VCF_NODES 20000
+
+// Выигрышная последовательность: ходы атакующего и вынужденные ответы защитника
+// по очереди; последний ход атакующего ставит ряд. Если закрыться защитнику
+// запрещено (рэндзю), его «ответ» совпадает с последним ходом атакующего.
+typedef struct {
+    int length;
+    int64_t x[VCF_MAX_MOVES], y[VCF_MAX_MOVES];
+} ThreatSequence;
+
+// Небольшая хеш-таблица позиций, в которых выигрыша угрозами нет (при той же
+// или большей оставшейся глубине). Её ведут поиски VCF и VCT.
+typedef struct {
+    uint64_t* keys;   // 1 << VCF_HASH_BITS ключей позиций
+    uint8_t* depths;  // оставшаяся глубина, при которой выигрыш не найден
+} FailureTable;
+
+void failureTableInit(FailureTable* t) {
+    t->keys = checkedCalloc(1 << VCF_HASH_BITS, sizeof(uint64_t));
+    t->depths = checkedCalloc(1 << VCF_HASH_BITS, 1);
+}
+
+void failureTableClear(FailureTable* t) {
+    memset(t->keys, 0, (1 << VCF_HASH_BITS) * sizeof(uint64_t));
+    memset(t->depths, 0, 1 << VCF_HASH_BITS);
+}
+
+void failureTableFree(FailureTable* t) {
+    free(t->keys);
+    free(t->depths);
+    t->keys = NULL;
+    t->depths = NULL;
+}
+
+// Известно ли, что в позиции key выигрыша нет при оставшейся глубине depth
+static inline int failureTableHit(const FailureTable* t, uint64_t key, int depth) {
+    uint64_t slot = key & ((1 << VCF_HASH_BITS) - 1);
+    return t->keys && t->keys[slot] == key && t->depths[slot] >= depth;
 }
 
-// Функция отображения текста
-void renderText(SDL_Renderer* renderer, const char* message, int x, int y, SDL_Color color) {
-    TTF_Font* font = TTF_OpenFont("arial.ttf", 24);
-    if (!font) {
-        printf("Failed to load font: %s\n", TTF_GetError());
-        return;
+static inline void failureTableStore(FailureTable* t, uint64_t key, int depth) {
+    if (!t->keys) return;
+    uint64_t slot = key & ((1 << VCF_HASH_BITS) - 1);
+    t->keys[slot] = key;
+    t->depths[slot] = (uint8_t)depth;
+}
+
+// Поиск VCF
+typedef struct {
+    Board* b;
+    Cell attacker;
+    uint64_t nodes, maxNodes;
+    int stopped;
+    FailureTable failures;
+    ThreatSequence line;
+} VcfSearch;
+
+VcfSearch vcf;
+
+void vcfInit(VcfSearch* v, Board* b) {
+    v->b = b;
+    failureTableInit(&v->failures);
+}
+
+void vcfFree(VcfSearch* v) {
+    failureTableFree(&v->failures);
+    memset(v, 0, sizeof(*v));
+}
+
+// Клетки, где атакующий получает четвёрку (закрытую или открытую)
+static int vcfFourCells(const Board* b, Cell player, int64_t* xs, int64_t* ys) {
+    int count = 0;
+    for (Shape shape = SHAPE_FOUR; shape <= SHAPE_OPEN_FOUR; shape++) {
+        const CellSet* cells = &b->sets[threatSet(player - PLAYER_X, shape)];
+        for (uint32_t i = 0; i < cells->count && count < VCF_MAX_BRANCH; i++) {
+            int64_t x, y;
+            cellCoords(b, cells->items[i], &x, &y);
+            // Клетка с открытой четвёркой может давать и четвёрку на другой линии
+            int seen = 0;
+            for (int j = 0; j < count && !seen; j++)
+                seen = xs[j] == x && ys[j] == y;
+            if (seen) continue;
+            xs[count] = x;
+            ys[count++] = y;
+        }
+    }
+    return count;
+}
+
+// Есть ли выигрыш сплошными четвёрками за depth ходов атакующего; ply — длина
+// уже записанной части последовательности
+static int vcfAttack(VcfSearch* v, int depth, int ply) {
+    Board* b = v->b;
+    Cell attacker = v->attacker, defender = PLAYER_X + PLAYER_O - attacker;
+    if (++v->nodes >= v->maxNodes && v->maxNodes) v->stopped = 1;
+    if (v->stopped) return 0;
+
+    if (rules->findWinningMove(b, attacker, &v->line.x[ply], &v->line.y[ply])) {
+        v->line.length = ply + 1;
+        return 1;
     }
+    if (depth == 0) return 0;
+    uint64_t key = searchKey(b, attacker);
+    if (failureTableHit(&v->failures, key, depth)) return 0;
 
-    SDL_Surface* surface = TTF_RenderText_Solid(font, message, color);
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    // Если защитник грозит пятью, четвёрка годится только в ту же клетку
+    int64_t blockX = 0, blockY = 0;
+    int mustBlock = rules->findWinningMove(b, defender, &blockX, &blockY);
 
-    SDL_Rect rect = {x, y, surface->w, surface->h};
-    SDL_RenderCopy(renderer, texture, NULL, &rect);
+    int64_t xs[VCF_MAX_BRANCH], ys[VCF_MAX_BRANCH];
+    int count = vcfFourCells(b, attacker, xs, ys);
+    for (int i = 0; i < count; i++) {
+        if (mustBlock && (xs[i] != blockX || ys[i] != blockY)) continue;
+        if (rules->isForbidden && rules->isForbidden(b, attacker, xs[i], ys[i])) continue;
+        makeMove(b, xs[i], ys[i], attacker);
+        // Ответ защитника — клетка, где атакующий поставил бы ряд; если у защитника
+        // самого есть пять, четвёрка опоздала
+        int64_t replyX, replyY, x, y;
+        if (!rules->findWinningMove(b, attacker, &replyX, &replyY) || rules->findWinningMove(b, defender, &x, &y)) {
+            unmakeMove(b);
+            continue;
+        }
+        v->line.x[ply] = xs[i];
+        v->line.y[ply] = ys[i];
+        v->line.x[ply + 1] = replyX;
+        v->line.y[ply + 1] = replyY;
+        int win;
+        if (rules->isForbidden && rules->isForbidden(b, defender, replyX, replyY)) {
+            // Защитнику закрыться запрещено: атакующий ставит ряд следующим ходом
+            v->line.x[ply + 2] = replyX;
+            v->line.y[ply + 2] = replyY;
+            v->line.length = ply + 3;
+            win = 1;
+        } else {
+            makeMove(b, replyX, replyY, defender);
+            win = vcfAttack(v, depth - 1, ply + 2);
+            unmakeMove(b);
+        }
+        unmakeMove(b);
+        if (win) return 1;
+        if (v->stopped) return 0;
+    }
 
-    SDL_FreeSurface(surface);
-    SDL_DestroyTexture(texture);
-    TTF_CloseFont(font);
+    failureTableStore(&v->failures, key, depth);
+    return 0;
 }
 
-// Отрисовка окна с результатом игры и кнопками "Close" и "Retry"
-void drawMessageBox(SDL_Renderer* renderer, const char* message) {
-    SDL_Color bgColor = {255, 255, 255, 255};
-    SDL_Color textColor = {0, 0, 0, 255};
+// Выигрыш игрока сплошными четвёрками в пределах maxNodes узлов (0 — без ограничения).
+// Последовательность записывается в line; поле возвращается в исходное состояние.
+int solveVcf(VcfSearch* v, Cell attacker, uint64_t maxNodes, ThreatSequence* line) {
+    v->attacker = attacker;
+    v->nodes = 0;
+    v->maxNodes = maxNodes;
+    v->stopped = 0;
+    v->line.length = 0;
+    int win = vcfAttack(v, VCF_MAX_DEPTH, 0);
+    if (win && line) *line = v->line;
+    return win;
+}
 
-    // Рисуем фон и рамку окна
-    SDL_SetRenderDrawColor(renderer, bgColor.r, bgColor.g, bgColor.b, bgColor.a);
-    SDL_Rect messageRect = {WINDOW_WIDTH / 4, WINDOW_HEIGHT / 3, WINDOW_WIDTH / 2, 150};
-    SDL_RenderFillRect(renderer, &messageRect);
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-    SDL_RenderDrawRect(renderer, &messageRect);
+// Поиск в пространстве угроз (VCT, по Аллису): атакующий ставит четвёрки и открытые
+// тройки, а защитник перебирает только ответы, которые могут снять угрозу: закрыть
+// пятую клетку, занять клетки, где тройка становится четвёркой, или поставить свою
+// четвёрку. Остальные ответы проигрывают сразу и не рассматриваются.
+#define VCT_MAX_DEPTH 12        // сколько угроз подряд может поставить атакующий
+#define VCT_MAX_BRANCH 24
+// Продление листьев альфа-бета поиска: глубина в угрозах и бюджет узлов
+#define VCT_LEAF_DEPTH 2
+#define VCT_LEAF_NODES 16
+// Бюджет поиска за компьютер и поиска подсказки, мс
+#define VCT_AI_MILLIS 150
+#define VCT_HINT_MILLIS 3000
 
-    renderText(renderer, message, messageRect.x + 10, messageRect.y + 20, textColor);
+typedef struct VctSearch {
+    Board* b;
+    Cell attacker;
+    SearchLimits limits;
+    uint32_t start;
+    uint64_t nodes;
+    const int* cancel;  // флаг отмены, который выставляет другой поток (NULL — нет)
+    int stopped;
+    FailureTable failures;
+    ThreatSequence line;
+} VctSearch;
 
-    // Рисуем кнопки
-    SDL_Rect closeButton = {messageRect.x + 10, messageRect.y + 70, 100, 40};
-    SDL_Rect retryButton = {messageRect.x + messageRect.w - 110, messageRect.y + 70, 100, 40};
+void vctInit(VctSearch* v, Board* b) {
+    memset(v, 0, sizeof(*v));
+    v->b = b;
+    failureTableInit(&v->failures);
+}
 
-    SDL_SetRenderDrawColor(renderer, 200, 0, 0, 255);
-    SDL_RenderFillRect(renderer, &closeButton);
-    renderText(renderer, "Close", closeButton.x + 10, closeButton.y + 10, textColor);
+void vctFree(VctSearch* v) {
+    failureTableFree(&v->failures);
+    memset(v, 0, sizeof(*v));
+}
 
-    SDL_SetRenderDrawColor(renderer, 0, 200, 0, 255);
-    SDL_RenderFillRect(renderer, &retryButton);
-    renderText(renderer, "Retry", retryButton.x + 10, retryButton.y + 10, textColor);
+// Поиск VCT за компьютер: таблица выделяется при первом ходе и очищается перед каждым поиском
+VctSearch vct;
+
+static VctSearch* aiThreatSearch(Board* b) {
+    if (!vct.failures.keys) vctInit(&vct, b);
+    vct.b = b;
+    failureTableClear(&vct.failures);
+    return &vct;
 }
 
-// Проверка, находится ли клик внутри заданного прямоугольника
-int isClickInsideRect(SDL_Rect rect, int x, int y) {
-    return (x >= rect.x && x <= rect.x + rect.w && y >= rect.y && y <= rect.y + rect.h);
+// Исчерпан ли бюджет или поиск отменён; время и отмена проверяются раз в 256 узлов
+static inline int vctStopped(VctSearch* v) {
+    if (v->stopped) return 1;
+    v->nodes++;
+    if (v->limits.maxNodes && v->nodes >= v->limits.maxNodes) v->stopped = 1;
+    if ((v->nodes & 255) == 0)
+        v->stopped |= (v->limits.millis && SDL_GetTicks() - v->start >= v->limits.millis) ||
+                      (v->cancel && __atomic_load_n(v->cancel, __ATOMIC_RELAXED));
+    return v->stopped;
 }
 
-// Отрисовка игрового поля
-void drawBoard(SDL_Renderer* renderer) {
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+// Добавление клеток множества фигуры shape игрока к списку без повторов
+static int collectCells(const Board* b, Cell player, Shape shape, int64_t* xs, int64_t* ys, int count, int max) {
+    const CellSet* cells = &b->sets[threatSet(player - PLAYER_X, shape)];
+    for (uint32_t i = 0; i < cells->count && count < max; i++) {
+        int64_t x, y;
+        cellCoords(b, cells->items[i], &x, &y);
+        int seen = 0;
+        for (int j = 0; j < count && !seen; j++)
+            seen = xs[j] == x && ys[j] == y;
+        if (seen) continue;
+        xs[count] = x;
+        ys[count++] = y;
+    }
+    return count;
+}
 
-    // Рассчитываем границы видимой области
-    int startX = cameraX / CELL_SIZE;
-    int startY = cameraY / CELL_SIZE;
-    int endX = (cameraX + WINDOW_WIDTH) / CELL_SIZE + 1;
-    int endY = (cameraY + WINDOW_HEIGHT) / CELL_SIZE + 1;
-
-    // Отрисовка клеток на видимой части поля
-    for (int i = startY; i <= endY; i++) {
-        for (int j = startX; j <= endX; j++) {
-            // Оборачивание координат клеток
-            int wrappedX = j % MAX_SIZE;
-            int wrappedY = i % MAX_SIZE;
-            if (wrappedX < 0) wrappedX += MAX_SIZE;
-            if (wrappedY < 0) wrappedY += MAX_SIZE;
-
-            int x = j * CELL_SIZE - cameraX;
-            int y = i * CELL_SIZE - cameraY;
-
-            SDL_Rect cellRect = { x, y, CELL_SIZE, CELL_SIZE };
-            SDL_RenderDrawRect(renderer, &cellRect);
+// Убирает из списка клетки, куда игроку ходить запрещено правилами
+static int dropForbidden(const Board* b, Cell player, int64_t* xs, int64_t* ys, int count) {
+    if (!rules->isForbidden) return count;
+    int kept = 0;
+    for (int i = 0; i < count; i++) {
+        if (rules->isForbidden(b, player, xs[i], ys[i])) continue;
+        xs[kept] = xs[i];
+        ys[kept++] = ys[i];
+    }
+    return kept;
+}
 
-            // Отрисовка X или O в клетке
-            if (board[wrappedY][wrappedX] == PLAYER_X) {
-                SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255);
-                SDL_RenderDrawLine(renderer, x + 10, y + 10, x + CELL_SIZE - 10, y + CELL_SIZE - 10);
-                SDL_RenderDrawLine(renderer, x + CELL_SIZE - 10, y + 10, x + 10, y + CELL_SIZE - 10);
-            } else if (board[wrappedY][wrappedX] == PLAYER_O) {
-                SDL_SetRenderDrawColor(renderer, 0, 0, 255, 255);
-                for (int angle = 0; angle < 360; angle++) {
-                    int drawX = 20 * cos(angle * M_PI / 180) + x + CELL_SIZE / 2;
-                    int drawY = 20 * sin(angle * M_PI / 180) + y + CELL_SIZE / 2;
-                    SDL_RenderDrawPoint(renderer, drawX, drawY);
-                }
-            }
+// Угрозы атакующего (не больше VCT_MAX_BRANCH): если защитник грозит пятью —
+// единственный ход, закрывающий её, иначе четвёрки, затем открытые тройки
+static int threatMoves(const Board* b, Cell attacker, int64_t* xs, int64_t* ys) {
+    Cell defender = PLAYER_X + PLAYER_O - attacker;
+    int count;
+    if (rules->findWinningMove(b, defender, &xs[0], &ys[0])) {
+        // Защитник грозит пятью: закрываемся, а его защита от прежних угроз продолжится
+        count = 1;
+    } else {
+        count = collectCells(b, attacker, SHAPE_OPEN_FOUR, xs, ys, 0, VCT_MAX_BRANCH);
+        count = collectCells(b, attacker, SHAPE_FOUR, xs, ys, count, VCT_MAX_BRANCH);
+        count = collectCells(b, attacker, SHAPE_OPEN_THREE, xs, ys, count, VCT_MAX_BRANCH);
+    }
+    return dropForbidden(b, attacker, xs, ys, count);
+}
+
+// Ответы защитника, которые могут снять угрозу атакующего; -1, если угрозы нет.
+// Ответ, запрещённый правилами, защитнику недоступен.
+static int threatReplies(const Board* b, Cell attacker, int64_t* xs, int64_t* ys) {
+    Cell defender = PLAYER_X + PLAYER_O - attacker;
+    int count = 0;
+    if (rules->findWinningMove(b, attacker, &xs[0], &ys[0])) {
+        // Четвёрка: закрыть можно только клетки, где атакующий ставит ряд
+        const CellSet* fives = &b->sets[threatSet(attacker - PLAYER_X, SHAPE_FIVE)];
+        for (uint32_t i = 0; i < fives->count && count < VCT_MAX_BRANCH; i++) {
+            cellCoords(b, fives->items[i], &xs[count], &ys[count]);
+            if (rules->wouldWin(b, attacker, xs[count], ys[count])) count++;
         }
+    } else {
+        // Тройка: угрозы нет, если атакующий не может поставить открытую четвёрку
+        if (b->sets[threatSet(attacker - PLAYER_X, SHAPE_OPEN_FOUR)].count == 0) return -1;
+        count = collectCells(b, attacker, SHAPE_OPEN_FOUR, xs, ys, 0, VCT_MAX_BRANCH);
+        count = collectCells(b, attacker, SHAPE_FOUR, xs, ys, count, VCT_MAX_BRANCH);
+        count = collectCells(b, defender, SHAPE_OPEN_FOUR, xs, ys, count, VCT_MAX_BRANCH);
+        count = collectCells(b, defender, SHAPE_FOUR, xs, ys, count, VCT_MAX_BRANCH);
     }
+    return dropForbidden(b, defender, xs, ys, count);
 }
 
-// Оптимизированная проверка победы по последнему ходу игрока
-int checkWin(Cell player, int lastX, int lastY) {
-    int directions[4][2] = {{1, 0}, {0, 1}, {1, 1}, {1, -1}}; // Проверка горизонтали, вертикали и диагоналей
+static int vctDefend(VctSearch* v, int depth, int ply);
 
-    // Проходим по каждому направлению
-    for (int d = 0; d < 4; d++) {
-        int count = 1; // Считаем последовательно идущие символы игрока
-        int dx = directions[d][0];
-        int dy = directions[d][1];
+// Ход атакующего: выигрывает ли он угрозами не более чем за depth ходов
+static int vctAttack(VctSearch* v, int depth, int ply) {
+    Board* b = v->b;
+    Cell attacker = v->attacker;
+    if (vctStopped(v)) return 0;
+    if (rules->findWinningMove(b, attacker, &v->line.x[ply], &v->line.y[ply])) {
+        v->line.length = ply + 1;
+        return 1;
+    }
+    if (depth == 0 || ply + 2 >= VCF_MAX_MOVES) return 0;
+    uint64_t key = searchKey(b, attacker);
+    if (failureTableHit(&v->failures, key, depth)) return 0;
 
-        // Проверка в одном направлении
-        for (int step = 1; step < WINNING_LENGTH; step++) {
-            int x = lastX + step * dx;
-            int y = lastY + step * dy;
-            if (x >= 0 && x < MAX_SIZE && y >= 0 && y < MAX_SIZE && board[y][x] == player) {
-                count++;
-            } else {
+    int64_t xs[VCT_MAX_BRANCH], ys[VCT_MAX_BRANCH];
+    int count = threatMoves(b, attacker, xs, ys);
+    for (int i = 0; i < count; i++) {
+        makeMove(b, xs[i], ys[i], attacker);
+        v->line.x[ply] = xs[i];
+        v->line.y[ply] = ys[i];
+        int win = vctDefend(v, depth - 1, ply + 1);
+        unmakeMove(b);
+        if (win) return 1;
+        if (v->stopped) return 0;
+    }
+    failureTableStore(&v->failures, key, depth);
+    return 0;
+}
+
+// Ход защитника: проигрывает ли он при любом ответе, снимающем угрозу
+static int vctDefend(VctSearch* v, int depth, int ply) {
+    Board* b = v->b;
+    Cell attacker = v->attacker, defender = PLAYER_X + PLAYER_O - attacker;
+    if (vctStopped(v)) return 0;
+    int64_t xs[VCT_MAX_BRANCH], ys[VCT_MAX_BRANCH];
+    // Своя пятёрка у защитника: угроза опоздала
+    if (rules->findWinningMove(b, defender, &xs[0], &ys[0])) return 0;
+
+    int count = threatReplies(b, attacker, xs, ys);
+    if (count < 0) return 0;
+
+    // Без ответов защитник проигрывает. Если закрыться ему запрещено (рэндзю), его
+    // «ответ» в последовательности совпадает со следующим ходом атакующего, как у VCF.
+    if (count == 0) {
+        if (vctAttack(v, depth, ply + 1)) {
+            v->line.x[ply] = v->line.x[ply + 1];
+            v->line.y[ply] = v->line.y[ply + 1];
+        } else {
+            v->line.length = ply;
+        }
+        return 1;
+    }
+    // В последовательность попадает первый ответ и выигрыш против него. Проверка
+    // остальных ответов перезаписывает line, поэтому она сохраняется отдельно.
+    ThreatSequence first;
+    for (int i = 0; i < count; i++) {
+        makeMove(b, xs[i], ys[i], defender);
+        int win = vctAttack(v, depth, ply + 1);
+        unmakeMove(b);
+        if (!win) return 0;
+        if (i == 0) {
+            v->line.x[ply] = xs[0];
+            v->line.y[ply] = ys[0];
+            first = v->line;
+        }
+    }
+    v->line = first;
+    return 1;
+}
+
+// Выигрыш игрока угрозами с ограничениями limits (maxDepth — число угроз подряд).
+// Глубина растёт постепенно, поэтому находится самый короткий выигрыш. cancel —
+// флаг, которым другой поток может прервать поиск. Поле возвращается в исходное состояние.
+int solveVct(VctSearch* v, Cell attacker, const SearchLimits* limits, const int* cancel, ThreatSequence* line) {
+    v->attacker = attacker;
+    v->limits = *limits;
+    v->start = SDL_GetTicks();
+    v->nodes = 0;
+    v->cancel = cancel;
+    v->stopped = 0;
+    v->line.length = 0;
+    int maxDepth = limits->maxDepth ? limits->maxDepth : VCT_MAX_DEPTH;
+    for (int depth = 1; depth <= maxDepth; depth++) {
+        if (vctAttack(v, depth, 0)) {
+            if (line) *line = v->line;
+            return 1;
+        }
+        if (v->stopped) break;
+    }
+    return 0;
+}
+
+// Продление листа альфа-бета поиска: длина выигрыша игрока угрозами или 0.
+// Поиск запускается, только если у игрока есть тройка или четвёрка.
+// Проверка выигрышной последовательности на поле: все ходы допустимы, а последний ход
+// атакующего ставит ряд. Ответ, совпадающий со следующим ходом атакующего, допустим,
+// только если все ответы на угрозу защитнику запрещены. Поле возвращается в исходное состояние.
+int threatSequenceWins(Board* b, Cell attacker, const ThreatSequence* line) {
+    Cell defender = PLAYER_X + PLAYER_O - attacker;
+    int played = 0, win = 0;
+    for (int i = 0; i < line->length; i++) {
+        int64_t x = line->x[i], y = line->y[i];
+        if (i % 2 == 0) {
+            if (!isLegalMove(b, attacker, x, y)) break;
+            if (i == line->length - 1) {
+                win = rules->wouldWin(b, attacker, x, y);
                 break;
             }
+            makeMove(b, x, y, attacker);
+        } else {
+            int64_t xs[VCT_MAX_BRANCH], ys[VCT_MAX_BRANCH];
+            if (i + 1 < line->length && line->x[i + 1] == x && line->y[i + 1] == y &&
+                threatReplies(b, attacker, xs, ys) == 0)
+                continue;
+            if (!isLegalMove(b, defender, x, y)) break;
+            makeMove(b, x, y, defender);
         }
+        played++;
+    }
+    while (played--) unmakeMove(b);
+    return win;
+}
 
-        // Проверка в противоположном направлении
-        for (int step = 1; step < WINNING_LENGTH; step++) {
-            int x = lastX - step * dx;
-            int y = lastY - step * dy;
-            if (x >= 0 && x < MAX_SIZE && y >= 0 && y < MAX_SIZE && board[y][x] == player) {
-                count++;
+static int leafThreatWin(VctSearch* v, Cell player) {
+    const Board* b = v->b;
+    int p = player - PLAYER_X;
+    if (!b->sets[threatSet(p, SHAPE_OPEN_THREE)].count && !b->sets[threatSet(p, SHAPE_FOUR)].count &&
+        !b->sets[threatSet(p, SHAPE_OPEN_FOUR)].count)
+        return 0;
+    SearchLimits limits = {VCT_LEAF_DEPTH, VCT_LEAF_NODES, 0};
+    return solveVct(v, player, &limits, NULL, NULL) ? v->line.length : 0;
+}
+
+// Исчерпан ли бюджет поиска; время проверяется раз в 1024 узла
+static inline int searchStopped(Search* s) {
+    if (!s->stopped && (++s->nodes & 1023) == 0)
+        s->stopped = (s->limits.maxNodes && s->nodes >= s->limits.maxNodes) ||
+                     (s->limits.millis && SDL_GetTicks() - s->start >= s->limits.millis);
+    return s->stopped;
+}
+
+// Оценка позиции для игрока player, который ходит на ply-м полуходе от корня
+static int negamax(Search* s, Cell player, int depth, int alpha, int beta, int ply) {
+    Board* b = s->b;
+    if (searchStopped(s)) return 0;
+    int64_t winX, winY;
+    if (rules->findWinningMove(b, player, &winX, &winY)) return SCORE_WIN - ply;
+    if (b->size && (b->stones == b->size * b->size || (b->windowStones[0] && b->liveWindows == 0)))
+        return 0;
+    Cell opponent = PLAYER_X + PLAYER_O - player;
+    if (depth <= 0) {
+        // Лист продлевается коротким поиском угроз за ходящего
+        int length = s->vct ? leafThreatWin(s->vct, player) : 0;
+        if (length) return SCORE_WIN - ply - length;
+        return (int)(b->threatScore[player - PLAYER_X] - b->threatScore[opponent - PLAYER_X]);
+    }
+
+    // Позиция уже встречалась: оценка годится, если посчитана не мельче, а лучший ход идёт первым
+    uint64_t key = searchKey(b, player);
+    TTEntry entry;
+    int known = ttProbe(&tt, key, &entry);
+    s->probes++;
+    if (known) {
+        s->hits++;
+        int score = scoreFromTable(entry.score, ply);
+        if (entry.depth >= depth && (entry.bound == TT_EXACT || (entry.bound == TT_LOWER && score >= beta) ||
+                                     (entry.bound == TT_UPPER && score <= alpha)))
+            return score;
+    }
+
+    ScoredMove moves[SEARCH_BRANCH];
+    int count = generateMoves(b, player, moves, SEARCH_BRANCH);
+    for (int i = 1; known && entry.hasMove && i < count; i++) {
+        int64_t x, y;
+        cellCoords(b, moves[i].ref, &x, &y);
+        if ((x & TT_MOVE_MASK) == entry.moveX && (y & TT_MOVE_MASK) == entry.moveY) {
+            ScoredMove move = moves[i];
+            memmove(moves + 1, moves, i * sizeof(ScoredMove));
+            moves[0] = move;
+            break;
+        }
+    }
+
+    int alphaOriginal = alpha, best = -SCORE_INFINITY;
+    int64_t bestX = 0, bestY = 0;
+    for (int i = 0; i < count; i++) {
+        int64_t x, y;
+        cellCoords(b, moves[i].ref, &x, &y);
+        if (rules->isForbidden && rules->isForbidden(b, player, x, y)) continue;
+        makeMove(b, x, y, player);
+        int score;
+        if (best == -SCORE_INFINITY) {
+            score = -negamax(s, opponent, depth - 1, -beta, -alpha, ply + 1);
+        } else {
+            score = -negamax(s, opponent, depth - 1, -alpha - 1, -alpha, ply + 1);
+            if (score > alpha && score < beta)
+                score = -negamax(s, opponent, depth - 1, -beta, -alpha, ply + 1);
+        }
+        unmakeMove(b);
+        if (s->stopped) return 0;
+        if (score > best) {
+            best = score;
+            bestX = x;
+            bestY = y;
+        }
+        if (score > alpha) alpha = score;
+        if (alpha >= beta) break;
+    }
+    // Ходов нет: все запрещены или поле кончилось
+    if (best == -SCORE_INFINITY) return count ? -(SCORE_WIN - ply - 1) : 0;
+
+    entry.score = scoreToTable(best, ply);
+    entry.depth = depth;
+    entry.bound = best <= alphaOriginal ? TT_UPPER : best >= beta ? TT_LOWER : TT_EXACT;
+    entry.hasMove = 1;
+    entry.moveX = bestX & TT_MOVE_MASK;
+    entry.moveY = bestY & TT_MOVE_MASK;
+    ttStore(&tt, key, &entry);
+    s->stores++;
+    return best;
+}
+
+// Лучший ход игрока в пределах ограничений. Поиск углубляется по одному полуходу;
+// если бюджет кончился посреди итерации, берётся лучший из уже просчитанных ходов
+// (первым всегда считается лучший ход прошлой итерации). Делает и отменяет ходы
+// на поле b, поэтому отменённые ходы, которые можно было повторить, теряются.
+SearchResult searchBestMove(Board* b, Cell player, const SearchLimits* limits) {
+    SearchResult result = {0};
+    if (b->stones == 0) {
+        // Первый ход — в центр поля
+        result.found = 1;
+        result.x = result.y = b->size / 2;
+        return result;
+    }
+
+    if (rules->findWinningMove(b, player, &result.x, &result.y)) {
+        result.found = 1;
+        result.score = SCORE_WIN - 1;
+        return result;
+    }
+
+    Search s = {b, *limits, SDL_GetTicks(), 0, 0, 0, 0, 0, aiThreatSearch(b)};
+    tt.age = (tt.age + 1) & 31;
+    ScoredMove moves[SEARCH_ROOT_BRANCH];
+    int count = 0, generated = generateMoves(b, player, moves, SEARCH_ROOT_BRANCH);
+    for (int i = 0; i < generated; i++) {
+        int64_t x, y;
+        cellCoords(b, moves[i].ref, &x, &y);
+        if (!rules->isForbidden || !rules->isForbidden(b, player, x, y)) moves[count++] = moves[i];
+    }
+    if (count == 0) return result;
+    result.found = 1;
+    cellCoords(b, moves[0].ref, &result.x, &result.y);
+
+    Cell opponent = PLAYER_X + PLAYER_O - player;
+    int maxDepth = limits->maxDepth ? limits->maxDepth : SEARCH_MAX_DEPTH;
+    for (int depth = 1; depth <= maxDepth; depth++) {
+        int alpha = -SCORE_INFINITY, bestIndex = -1;
+        for (int i = 0; i < count; i++) {
+            int64_t x, y;
+            cellCoords(b, moves[i].ref, &x, &y);
+            makeMove(b, x, y, player);
+            int score;
+            if (i == 0) {
+                score = -negamax(&s, opponent, depth - 1, -SCORE_INFINITY, SCORE_INFINITY, 1);
             } else {
-                break;
+                score = -negamax(&s, opponent, depth - 1, -alpha - 1, -alpha, 1);
+                if (score > alpha)
+                    score = -negamax(&s, opponent, depth - 1, -SCORE_INFINITY, -alpha, 1);
             }
+            unmakeMove(b);
+            if (s.stopped) break;
+            if (score > alpha) {
+                alpha = score;
+                bestIndex = i;
+            }
+        }
+        if (bestIndex >= 0) {
+            // Лучший ход переходит в начало списка для следующей итерации
+            ScoredMove best = moves[bestIndex];
+            memmove(moves + 1, moves, bestIndex * sizeof(ScoredMove));
+            moves[0] = best;
+            cellCoords(b, best.ref, &result.x, &result.y);
+            result.score = alpha;
         }
+        if (s.stopped) break;
+        result.depth = depth;
+        // Исход уже ясен: дальше углубляться незачем
+        if (alpha >= SCORE_WIN - SEARCH_MAX_DEPTH || alpha <= -SCORE_WIN + SEARCH_MAX_DEPTH) break;
+    }
+    result.nodes = s.nodes;
+    __atomic_fetch_add(&tt.probes, s.probes, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&tt.hits, s.hits, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&tt.stores, s.stores, __ATOMIC_RELAXED);
+    return result;
+}
 
-        // Проверка на победу
-        if (count >= WINNING_LENGTH) {
+// Доказательство выигрыша поиском по числам доказательства в глубину (df-pn).
+// Узел — позиция с очередью хода: у атакующего это узел «или» (хватит одного
+// выигрывающего хода), у защитника — «и» (выигрыш нужен против всех ответов).
+// pn — сколько ещё листьев нужно доказать, чтобы доказать выигрыш, dn — чтобы
+// опровергнуть. Ходы те же, что у VCT: угрозы атакующего и ответы, снимающие угрозу,
+// поэтому поиск не выходит за активную область поля. Опровержение значит лишь, что
+// угрозами выигрыша нет.
+#define DFPN_INFINITY 0x3FFFFFFFu
+#define DFPN_MAX_PLY (2 * VCT_MAX_DEPTH)  // столько же угроз подряд, сколько у VCT
+// Приём 1+ε: порог лучшего потомка — второе по величине число с запасом 1/DFPN_EPSILON_DIV,
+// чтобы поиск реже перескакивал между почти равными потомками
+#define DFPN_EPSILON_DIV 4
+// Начальное pn узла после хода атакующего, которого нет в таблице: на четвёрку у
+// защитника один ответ, на тройку — несколько, поэтому тройка доказывается дороже
+#define DFPN_THREE_PN 5
+// Бюджет решения позиции из командной строки
+#define DFPN_NODES 20000000
+#define DFPN_MILLIS 60000
+
+// Запись таблицы: ключ узла и его числа доказательства и опровержения
+typedef struct {
+    uint64_t key;
+    uint32_t pn, dn;
+} DfpnEntry;
+
+typedef struct {
+    Board* b;
+    Cell attacker;
+    SearchLimits limits;
+    uint32_t start;
+    uint64_t nodes;
+    int stopped;
+    DfpnEntry* table;  // корзины по две записи
+    uint64_t mask;
+} DfpnSearch;
+
+void dfpnInit(DfpnSearch* d, Board* b, size_t megabytes) {
+    memset(d, 0, sizeof(*d));
+    d->b = b;
+    size_t entries = 2;
+    while (entries * 2 * sizeof(DfpnEntry) <= (megabytes << 20)) entries *= 2;
+    d->table = checkedCalloc(entries, sizeof(DfpnEntry));
+    d->mask = entries - 1;
+}
+
+void dfpnFree(DfpnSearch* d) {
+    free(d->table);
+    memset(d, 0, sizeof(*d));
+}
+
+// Ключ узла по ключу Зобриста поля: очередь хода и атакующий
+static inline uint64_t dfpnKey(const DfpnSearch* d, uint64_t hash, Cell toMove) {
+    return hash ^ (toMove == PLAYER_O ? 0xD6E8FEB86659FD93ULL : 0) ^ (d->attacker == PLAYER_O ? 0x9FB21C651E98DF25ULL : 0);
+}
+
+// Числа узла из таблицы; неизвестный узел получает pn = dn = 1 и возвращается 0
+static inline int dfpnLookup(const DfpnSearch* d, uint64_t key, uint32_t* pn, uint32_t* dn) {
+    const DfpnEntry* bucket = &d->table[key & d->mask & ~1ULL];
+    for (int i = 0; i < 2; i++) {
+        if (bucket[i].key == key) {
+            *pn = bucket[i].pn;
+            *dn = bucket[i].dn;
             return 1;
         }
     }
+    *pn = *dn = 1;
     return 0;
 }
 
-// Функция для хода компьютера, блокирующая игрока и реагирующая на последний ход
-void aiMove(int lastPlayerX, int lastPlayerY) {
-    int blockX = -1, blockY = -1;
-    int searchRadius = 2; // Радиус поиска вокруг последнего хода игрока
-
-    // Поиск угроз от игрока в ограниченной области вокруг последнего хода
-    for (int i = lastPlayerY - searchRadius; i <= lastPlayerY + searchRadius; i++) {
-        for (int j = lastPlayerX - searchRadius; j <= lastPlayerX + searchRadius; j++) {
-            // Проверяем, что координаты находятся в пределах поля и клетка пуста
-            if (i >= 0 && i < MAX_SIZE && j >= 0 && j < MAX_SIZE && board[i][j] == EMPTY) {
-                // Проверяем, если бы игрок поставил "X" в эту клетку, это привело бы к победе?
-                board[i][j] = PLAYER_X;
-                if (checkWin(PLAYER_X, j, i)) {
-                    blockX = j;
-                    blockY = i;
-                }
-                board[i][j] = EMPTY;
+// Запись узла. Доказанные узлы вытесняются в последнюю очередь: по ним строится
+// дерево доказательства.
+static inline void dfpnStore(DfpnSearch* d, uint64_t key, uint32_t pn, uint32_t dn) {
+    DfpnEntry* bucket = &d->table[key & d->mask & ~1ULL];
+    DfpnEntry* e = &bucket[1];
+    if (bucket[0].key == key || bucket[0].key == 0 || (bucket[1].key != key && (bucket[0].pn || !bucket[1].pn)))
+        e = &bucket[0];
+    e->key = key;
+    e->pn = pn;
+    e->dn = dn;
+}
 
-                // Если нашли угрозу, блокируем её
-                if (blockX != -1 && blockY != -1) {
-                    board[blockY][blockX] = PLAYER_O;
-                    return;
-                }
+// Исчерпан ли бюджет; время проверяется раз в 256 узлов
+static inline int dfpnStopped(DfpnSearch* d) {
+    if (d->stopped) return 1;
+    d->nodes++;
+    if (d->limits.maxNodes && d->nodes >= d->limits.maxNodes) d->stopped = 1;
+    if ((d->nodes & 255) == 0 && d->limits.millis && SDL_GetTicks() - d->start >= d->limits.millis) d->stopped = 1;
+    return d->stopped;
+}
+
+// Ходы узла; -1, если узел решён сразу (тогда числа записаны в pn и dn)
+static int dfpnMoves(DfpnSearch* d, Cell toMove, int ply, int64_t* xs, int64_t* ys, uint32_t* pn, uint32_t* dn) {
+    const Board* b = d->b;
+    Cell attacker = d->attacker, defender = PLAYER_X + PLAYER_O - attacker;
+    int count;
+    if (toMove == attacker) {
+        if (rules->findWinningMove(b, attacker, &xs[0], &ys[0])) {
+            *pn = 0;
+            *dn = DFPN_INFINITY;
+            return -1;
+        }
+        count = ply < DFPN_MAX_PLY ? threatMoves(b, attacker, xs, ys) : 0;
+        if (count == 0) {
+            *pn = DFPN_INFINITY;
+            *dn = 0;
+            return -1;
+        }
+    } else {
+        // Своя пятёрка у защитника или угрозы нет — выигрыш угрозами опровергнут;
+        // без разрешённых ответов защитник проигрывает
+        count = rules->findWinningMove(b, defender, &xs[0], &ys[0]) ? -1 : threatReplies(b, attacker, xs, ys);
+        if (count <= 0) {
+            *pn = count < 0 ? DFPN_INFINITY : 0;
+            *dn = count < 0 ? 0 : DFPN_INFINITY;
+            return -1;
+        }
+    }
+    return count;
+}
+
+// Поиск в узле, пока его pn меньше thPn и dn меньше thDn. Итоговые числа узла
+// записываются в таблицу и в pn, dn.
+static void dfpnMid(DfpnSearch* d, Cell toMove, uint32_t thPn, uint32_t thDn, int ply, uint32_t* pn, uint32_t* dn) {
+    Board* b = d->b;
+    Cell next = PLAYER_X + PLAYER_O - toMove;
+    uint64_t key = dfpnKey(d, b->hash, toMove);
+    int64_t xs[VCT_MAX_BRANCH], ys[VCT_MAX_BRANCH];
+    // Узел, решённый сразу, в таблицу не пишется: его числа дешевле получить заново,
+    // чем вытеснять ими доказательства, нужные для дерева
+    int count = dfpnMoves(d, toMove, ply, xs, ys, pn, dn);
+    if (count < 0) return;
+    if (dfpnStopped(d)) {
+        dfpnLookup(d, key, pn, dn);
+        return;
+    }
+
+    // Числа потомков берутся из таблицы один раз, дальше — из их поиска
+    int orNode = toMove == d->attacker;
+    uint32_t pns[VCT_MAX_BRANCH], dns[VCT_MAX_BRANCH];
+    for (int i = 0; i < count; i++)
+        if (!dfpnLookup(d, dfpnKey(d, b->hash ^ zobristKey(toMove - PLAYER_X, xs[i], ys[i]), next), &pns[i], &dns[i]) &&
+            orNode && bestThreat(b, toMove, xs[i], ys[i]) < SHAPE_FOUR)
+            pns[i] = DFPN_THREE_PN;
+
+    for (;;) {
+        // В узле «или» pn — минимум по потомкам, dn — сумма; в узле «и» наоборот.
+        // Сравниваемые числа потомков: pn в узле «или», dn в узле «и».
+        uint32_t* mins = orNode ? pns : dns;
+        uint32_t* sums = orNode ? dns : pns;
+        uint32_t least = DFPN_INFINITY, second = DFPN_INFINITY, total = 0;
+        int best = 0;
+        for (int i = 0; i < count; i++) {
+            if (mins[i] < least) {
+                second = least;
+                least = mins[i];
+                best = i;
+            } else if (mins[i] < second) {
+                second = mins[i];
+            }
+            total = total + sums[i] < DFPN_INFINITY ? total + sums[i] : DFPN_INFINITY;
+        }
+        *pn = orNode ? least : total;
+        *dn = orNode ? total : least;
+        if (*pn >= thPn || *dn >= thDn || d->stopped) break;
+
+        uint32_t thMin = orNode ? thPn : thDn, thSum = orNode ? thDn : thPn;
+        uint32_t childMin = second + second / DFPN_EPSILON_DIV + 1;
+        if (childMin > thMin) childMin = thMin;
+        uint32_t childSum = thSum - total + sums[best];
+        makeMove(b, xs[best], ys[best], toMove);
+        dfpnMid(d, next, orNode ? childMin : childSum, orNode ? childSum : childMin, ply + 1, &pns[best], &dns[best]);
+        unmakeMove(b);
+    }
+    dfpnStore(d, key, *pn, *dn);
+}
+
+// Доказательство выигрыша attacker в позиции, где ход за toMove, с ограничениями
+// limits (maxDepth не используется). Возвращает 1 — выигрыш доказан, -1 — угрозами
+// выигрыша нет, 0 — бюджет исчерпан. Поле возвращается в исходное состояние.
+int solveDfpn(DfpnSearch* d, Cell attacker, Cell toMove, const SearchLimits* limits) {
+    d->attacker = attacker;
+    d->limits = *limits;
+    d->start = SDL_GetTicks();
+    d->nodes = 0;
+    d->stopped = 0;
+    uint32_t pn, dn;
+    dfpnMid(d, toMove, DFPN_INFINITY, DFPN_INFINITY, 0, &pn, &dn);
+    return pn == 0 ? 1 : dn == 0 ? -1 : 0;
+}
+
+// Доказан ли выигрыш в узле после хода (x, y). Узла нет в таблице — он раскрывается
+// на один ход, а если solve не равно 0, решается заново.
+static int dfpnProven(DfpnSearch* d, Cell toMove, int64_t x, int64_t y, int solve) {
+    Cell next = PLAYER_X + PLAYER_O - toMove;
+    uint32_t pn, dn, threshold = solve ? DFPN_INFINITY : 1;
+    dfpnLookup(d, dfpnKey(d, d->b->hash ^ zobristKey(toMove - PLAYER_X, x, y), next), &pn, &dn);
+    if (pn == 0 || dn == 0) return pn == 0;
+    makeMove(d->b, x, y, toMove);
+    dfpnMid(d, next, threshold, threshold, 0, &pn, &dn);
+    unmakeMove(d->b);
+    return pn == 0;
+}
+
+// Запись дерева доказательства: строка на ход, отступ — два пробела на каждый ход
+// от корня. За ходом атакующего идут все ответы защитника, снимающие угрозу, за
+// каждым ответом — выигрывающий ход атакующего; лист — ход, ставящий ряд.
+// Узел, доказанный через перестановку, может лежать глубже DFPN_MAX_PLY, поэтому
+// при записи глубина не ограничивается. Возвращает 0, если доказательство не удалось восстановить.
+static int dfpnWriteProof(DfpnSearch* d, Cell toMove, int ply, FILE* file, uint64_t* moves) {
+    Board* b = d->b;
+    Cell next = PLAYER_X + PLAYER_O - toMove;
+    int64_t xs[VCT_MAX_BRANCH], ys[VCT_MAX_BRANCH];
+    uint32_t pn, dn;
+    if (toMove == d->attacker && rules->findWinningMove(b, toMove, &xs[0], &ys[0])) {
+        fprintf(file, "%*s%lld %lld\n", 2 * ply, "", (long long)xs[0], (long long)ys[0]);
+        ++*moves;
+        return 1;
+    }
+    int count = dfpnMoves(d, toMove, 0, xs, ys, &pn, &dn);
+    if (count < 0) return pn == 0;
+    if (toMove == d->attacker) {
+        // Атакующему достаточно одного хода: сначала ищется доказанный в таблице,
+        // и только потом ходы решаются заново
+        int best = -1;
+        for (int i = 0; i < count && best < 0; i++)
+            if (dfpnProven(d, toMove, xs[i], ys[i], 0)) best = i;
+        for (int i = 0; i < count && best < 0; i++)
+            if (dfpnProven(d, toMove, xs[i], ys[i], 1)) best = i;
+        if (best < 0) return 0;
+        xs[0] = xs[best];
+        ys[0] = ys[best];
+        count = 1;
+    }
+    for (int i = 0; i < count; i++) {
+        if (!dfpnProven(d, toMove, xs[i], ys[i], 1)) return 0;
+        fprintf(file, "%*s%lld %lld\n", 2 * ply, "", (long long)xs[i], (long long)ys[i]);
+        ++*moves;
+        makeMove(b, xs[i], ys[i], toMove);
+        int ok = dfpnWriteProof(d, next, ply + 1, file, moves);
+        unmakeMove(b);
+        if (!ok) return 0;
+    }
+    return 1;
+}
+
+// Чей ход в позиции: крестики ходят первыми
+static Cell sideToMove(const Board* b) {
+    int64_t balance = 0;
+    for (int64_t y = b->minY; y <= b->maxY && b->stones; y++)
+        for (int64_t x = b->minX; x <= b->maxX; x++)
+            balance += getCell(b, x, y) == PLAYER_X ? 1 : getCell(b, x, y) == PLAYER_O ? -1 : 0;
+    return balance > 0 ? PLAYER_O : PLAYER_X;
+}
+
+// Решение позиции из файла: df-pn доказывает выигрыш того, чей ход, а если его нет —
+// выигрыш соперника против всех ответов, снимающих его угрозы. Доказательство вместе
+// с позицией записывается в proofPath (NULL — не записывается).
+int solvePositionFile(const char* path, const char* proofPath, size_t megabytes) {
+    Board position = {0};
+    initBoard(&position, variant->size, variant->torus, variant->k);
+    if (!loadPosition(&position, path)) {
+        freeBoard(&position);
+        return 1;
+    }
+    Cell toMove = sideToMove(&position), other = PLAYER_X + PLAYER_O - toMove;
+    DfpnSearch d;
+    dfpnInit(&d, &position, megabytes);
+    SearchLimits limits = {0, DFPN_NODES, DFPN_MILLIS};
+    int result = solveDfpn(&d, toMove, toMove, &limits);
+    uint64_t nodes = d.nodes;
+    if (result != 1) {
+        int reply = solveDfpn(&d, other, toMove, &limits);
+        nodes += d.nodes;
+        result = reply == 1 ? 1 : result == 0 || reply == 0 ? 0 : -1;
+    }
+    Cell winner = d.attacker;
+
+    int status = 0;
+    if (result == 1) {
+        printf("%s: %c to move, %c wins (%llu nodes)\n", path, toMove == PLAYER_X ? 'X' : 'O',
+               winner == PLAYER_X ? 'X' : 'O', (unsigned long long)nodes);
+    } else {
+        printf("%s: %c to move, %s (%llu nodes)\n", path, toMove == PLAYER_X ? 'X' : 'O',
+               result < 0 ? "no win by threats for either side" : "unknown, budget exhausted", (unsigned long long)nodes);
+    }
+    if (result == 1 && proofPath) {
+        FILE* file = fopen(proofPath, "w");
+        if (!file) {
+            printf("Failed to save proof: %s\n", proofPath);
+            status = 1;
+        } else {
+            // На восстановление дерева — новый бюджет
+            d.start = SDL_GetTicks();
+            d.nodes = 0;
+            d.stopped = 0;
+            uint64_t moves = 0;
+            fprintf(file, "dfpn %s %s %c %c\n", variant->name, rules->name, winner == PLAYER_X ? 'X' : 'O',
+                    toMove == PLAYER_X ? 'X' : 'O');
+            writePosition(&position, file);
+            if (dfpnWriteProof(&d, toMove, 0, file, &moves)) {
+                printf("%s: proof tree with %llu moves\n", proofPath, (unsigned long long)moves);
+            } else {
+                printf("%s: proof tree is incomplete\n", proofPath);
+                status = 1;
+            }
+            fclose(file);
+        }
+    }
+    dfpnFree(&d);
+    freeBoard(&position);
+    return status;
+}
+
+// Ход дерева доказательства: глубина (по отступу) и номер строки файла
+typedef struct {
+    int depth;
+    int64_t x, y;
+    size_t line;
+} ProofMove;
+
+typedef struct {
+    Board* b;
+    Cell attacker;
+    const ProofMove* moves;
+    size_t count, next;
+    int maxDepth;
+} ProofReplay;
+
+// Номер строки следующего хода дерева (за последним ходом — строка после него)
+static size_t proofLine(const ProofReplay* r) {
+    return r->next < r->count ? r->moves[r->next].line : r->count ? r->moves[r->count - 1].line + 1 : 0;
+}
+
+// Проверка поддерева с корнем на глубине ply: ход атакующего должен быть разрешён
+// и вести к выигрышу, а ответы защитника — совпадать со всеми ответами, снимающими угрозу
+static int replayProof(ProofReplay* r, Cell toMove, int ply) {
+    Board* b = r->b;
+    Cell next = PLAYER_X + PLAYER_O - toMove;
+    if (ply > r->maxDepth) r->maxDepth = ply;
+    if (toMove == r->attacker) {
+        if (r->next >= r->count || r->moves[r->next].depth != ply) {
+            printf("line %zu: missing move of %c\n", proofLine(r), toMove == PLAYER_X ? 'X' : 'O');
+            return 0;
+        }
+        const ProofMove* m = &r->moves[r->next++];
+        if (!isLegalMove(b, toMove, m->x, m->y)) {
+            printf("line %zu: illegal move (%lld, %lld)\n", m->line, (long long)m->x, (long long)m->y);
+            return 0;
+        }
+        if (rules->wouldWin(b, toMove, m->x, m->y)) {
+            if (r->next < r->count && r->moves[r->next].depth > ply) {
+                printf("line %zu: moves after a win\n", r->moves[r->next].line);
+                return 0;
+            }
+            return 1;
+        }
+        makeMove(b, m->x, m->y, toMove);
+        int ok = replayProof(r, next, ply + 1);
+        unmakeMove(b);
+        return ok;
+    }
+
+    int64_t xs[VCT_MAX_BRANCH], ys[VCT_MAX_BRANCH];
+    size_t line = proofLine(r);
+    if (rules->findWinningMove(b, toMove, &xs[0], &ys[0])) {
+        printf("line %zu: defender wins first\n", line);
+        return 0;
+    }
+    int count = threatReplies(b, r->attacker, xs, ys), covered = 0;
+    if (count < 0) {
+        printf("line %zu: no threat to answer\n", line);
+        return 0;
+    }
+    int seen[VCT_MAX_BRANCH] = {0};
+    while (r->next < r->count && r->moves[r->next].depth == ply) {
+        const ProofMove* m = &r->moves[r->next++];
+        int i = 0;
+        while (i < count && (xs[i] != m->x || ys[i] != m->y)) i++;
+        if (i == count || seen[i]) {
+            printf("line %zu: (%lld, %lld) is not an answer to the threat\n", m->line, (long long)m->x, (long long)m->y);
+            return 0;
+        }
+        seen[i] = 1;
+        covered++;
+        makeMove(b, m->x, m->y, toMove);
+        int ok = replayProof(r, next, ply + 1);
+        unmakeMove(b);
+        if (!ok) return 0;
+    }
+    if (r->next < r->count && r->moves[r->next].depth > ply) {
+        printf("line %zu: unexpected indentation\n", r->moves[r->next].line);
+        return 0;
+    }
+    for (int i = 0; i < count && covered < count; i++) {
+        if (seen[i]) continue;
+        printf("line %zu: answer (%lld, %lld) is not covered\n", line, (long long)xs[i], (long long)ys[i]);
+        return 0;
+    }
+    return 1;
+}
+
+// Воспроизведение дерева доказательства из файла solve: вариант и правила берутся
+// из заголовка, каждый ход проверяется на поле. Печатается главная линия.
+int replayProofFile(const char* path) {
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        printf("Failed to load proof: %s\n", path);
+        return 1;
+    }
+    char variantName[32], rulesName[32], attackerName, toMoveName;
+    if (fscanf(file, "dfpn %31s %31s %c %c", variantName, rulesName, &attackerName, &toMoveName) != 4 ||
+        !findVariant(variantName) || !findRuleSet(rulesName) || !strchr("XO", attackerName) || !strchr("XO", toMoveName)) {
+        printf("Invalid proof file: %s\n", path);
+        fclose(file);
+        return 1;
+    }
+    variant = findVariant(variantName);
+    rules = findRuleSet(rulesName);
+    Board position = {0};
+    initBoard(&position, variant->size, variant->torus, variant->k);
+    if (!readPosition(&position, file)) {
+        printf("Invalid proof file: %s\n", path);
+        fclose(file);
+        freeBoard(&position);
+        return 1;
+    }
+
+    // Строки дерева: позиция занимает первую строку заголовка и строки поля
+    size_t count = 0, capacity = 256, lineNumber = 2 + (size_t)(position.stones ? position.maxY - position.minY + 1 : 0);
+    ProofMove* moves = malloc(capacity * sizeof(ProofMove));
+    char text[256];
+    int valid = moves != NULL;
+    while (valid && fgets(text, sizeof(text), file)) {
+        lineNumber++;
+        int indent = 0;
+        while (text[indent] == ' ') indent++;
+        long long x, y;
+        if (text[indent] == '\n' || text[indent] == '\0') continue;
+        if (indent % 2 || sscanf(text + indent, "%lld %lld", &x, &y) != 2) {
+            printf("line %zu: invalid move\n", lineNumber);
+            valid = 0;
+            break;
+        }
+        if (count == capacity) {
+            capacity *= 2;
+            ProofMove* grown = realloc(moves, capacity * sizeof(ProofMove));
+            if (!grown) {
+                valid = 0;
+                break;
             }
+            moves = grown;
+        }
+        moves[count++] = (ProofMove){indent / 2, x, y, lineNumber};
+    }
+    fclose(file);
+
+    ProofReplay r = {&position, attackerName == 'X' ? PLAYER_X : PLAYER_O, moves, count, 0, 0};
+    valid = valid && replayProof(&r, toMoveName == 'X' ? PLAYER_X : PLAYER_O, 0);
+    if (valid && r.next < count) {
+        printf("line %zu: moves after the proof\n", moves[r.next].line);
+        valid = 0;
+    }
+    if (valid) {
+        printf("%s: %s, %c to move, %c wins, proof verified (%zu moves, depth %d)\nmain line:", path, variant->name,
+               toMoveName, attackerName, count, r.maxDepth + 1);
+        // Главная линия — первая ветвь дерева
+        for (size_t i = 0; i < count && (int)moves[i].depth == (int)i; i++)
+            printf(" (%lld, %lld)", (long long)moves[i].x, (long long)moves[i].y);
+        printf("\n");
+    } else {
+        printf("%s: proof rejected\n", path);
+    }
+    free(moves);
+    freeBoard(&position);
+    return !valid;
+}
+
+// Копия позиции src в dst (без истории ходов)
+void clonePosition(Board* dst, const Board* src) {
+    initBoard(dst, src->size, src->wrapMask != 0, src->winLength);
+    for (uint32_t i = 0; i < src->tileCount; i++) {
+        const Tile* tile = src->tiles[i];
+        if (tile->gen != src->generation || tile->stones == 0) continue;
+        for (int p = 0; p < 2; p++)
+            for (int ly = 0; ly < TILE_SIZE; ly++)
+                for (uint32_t row = tile->rows[p][ly]; row; row &= row - 1)
+                    setCell(dst, tile->tx * TILE_SIZE + __builtin_ctz(row), tile->ty * TILE_SIZE + ly, PLAYER_X + p);
+    }
+}
+
+// Подсказка игроку (клавиша H): выигрыш угрозами ищется в отдельном потоке на копии
+// поля, поэтому интерфейс не ждёт. Когда позиция меняется, поиск отменяется и
+// начинается заново.
+typedef struct {
+    Board board;
+    VcfSearch vcf;
+    VctSearch vct;
+    ThreatSequence line;
+    SDL_Thread* thread;
+    int cancel;      // интерфейс просит поток остановиться
+    int ready;       // поток закончил работу; found и line можно читать
+    int found;
+} HintWorker;
+
+int showHint = 0;
+HintWorker hint;
+uint64_t hintKey;  // позиция, для которой ищется подсказка
+
+static int hintThread(void* data) {
+    HintWorker* w = data;
+    SearchLimits limits = {0, 0, VCT_HINT_MILLIS};
+    // Как у компьютера: сначала сплошные четвёрки, затем угрозы. Подсвечивается
+    // только последовательность, которая проверена на поле.
+    w->found = (solveVcf(&w->vcf, PLAYER_X, VCF_NODES, &w->line) ||
+                solveVct(&w->vct, PLAYER_X, &limits, &w->cancel, &w->line)) &&
+               threatSequenceWins(&w->board, PLAYER_X, &w->line);
+    __atomic_store_n(&w->ready, 1, __ATOMIC_RELEASE);
+    return 0;
+}
+
+// Остановка потока подсказки, если он работает
+void cancelHint(HintWorker* w) {
+    if (!w->thread) return;
+    __atomic_store_n(&w->cancel, 1, __ATOMIC_RELAXED);
+    SDL_WaitThread(w->thread, NULL);
+    w->thread = NULL;
+}
+
+// Запуск поиска подсказки для текущей позиции
+void startHint(HintWorker* w) {
+    cancelHint(w);
+    if (!w->vcf.failures.keys) vcfInit(&w->vcf, &w->board);
+    if (!w->vct.failures.keys) vctInit(&w->vct, &w->board);
+    clonePosition(&w->board, &board);
+    w->cancel = 0;
+    w->ready = 0;
+    w->found = 0;
+    w->thread = SDL_CreateThread(hintThread, "hint", w);
+    if (!w->thread) printf("Failed to start hint thread: %s\n", SDL_GetError());
+}
+
+// Подсветка клетки подсказки: первый ход ярче остальных ходов атакующего
+static void drawHintCell(SDL_Renderer* renderer, int64_t x, int64_t y, int first) {
+    SDL_Rect rect = {(int)(x * CELL_SIZE - cameraX) + 1, (int)(y * CELL_SIZE - cameraY) + 1, CELL_SIZE - 2, CELL_SIZE - 2};
+    SDL_SetRenderDrawColor(renderer, 255, first ? 190 : 230, first ? 90 : 160, 255);
+    SDL_RenderFillRect(renderer, &rect);
+}
+
+// Отрисовка подсказки: ходы атакующего из найденной последовательности.
+// На торе подсвечиваются все видимые копии клетки.
+void drawHint(SDL_Renderer* renderer, const ThreatSequence* hint) {
+    for (int i = 0; i < hint->length; i += 2) {
+        if (!board.wrapMask) {
+            drawHintCell(renderer, hint->x[i], hint->y[i], i == 0);
+            continue;
         }
+        int64_t startX = floorDiv(cameraX, CELL_SIZE), startY = floorDiv(cameraY, CELL_SIZE);
+        for (int64_t y = startY; y <= floorDiv(cameraY + WINDOW_HEIGHT, CELL_SIZE); y++)
+            for (int64_t x = startX; x <= floorDiv(cameraX + WINDOW_WIDTH, CELL_SIZE); x++)
+                if ((x & board.wrapMask) == hint->x[i] && (y & board.wrapMask) == hint->y[i])
+                    drawHintCell(renderer, x, y, i == 0);
+    }
+}
+
+// Выбор хода компьютера: выигрыш сплошными четвёрками или угрозами, если он есть,
+// иначе поиск с ограничением по времени, а если ходов-кандидатов нет — ход рядом с последним ходом игрока.
+// Поле не изменяется: выбранная клетка возвращается через moveX и moveY.
+void aiMove(int64_t lastPlayerX, int64_t lastPlayerY, int64_t* moveX, int64_t* moveY) {
+    // Сначала ищем выигрыш сплошными четвёрками, затем выигрыш угрозами
+    ThreatSequence line;
+    if (solveVcf(&vcf, PLAYER_O, VCF_NODES, &line)) {
+        *moveX = line.x[0];
+        *moveY = line.y[0];
+        return;
+    }
+    SearchLimits threatLimits = {0, 0, VCT_AI_MILLIS};
+    if (solveVct(aiThreatSearch(&board), PLAYER_O, &threatLimits, NULL, &line)) {
+        *moveX = line.x[0];
+        *moveY = line.y[0];
+        return;
+    }
+
+    // Ищем лучший ход среди кандидатов рядом с камнями с ограничением по времени
+    SearchLimits limits = {0, 0, AI_THINK_MILLIS};
+    SearchResult result = searchBestMove(&board, PLAYER_O, &limits);
+    if (result.found) {
+        *moveX = result.x;
+        *moveY = result.y;
+        return;
     }
 
-    // Если угрозы нет, ходим рядом с последним ходом игрока
+    // Если ходов-кандидатов нет, ходим рядом с последним ходом игрока.
+    // На конечном поле соседи читаются из копии с рамкой: клетки WALL не пусты.
     int directions[8][2] = {{-1, -1}, {-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, -1}, {1, 0}, {1, 1}};
+    const uint8_t* last = board.padded ? paddedCell(&board, lastPlayerX, lastPlayerY) : NULL;
     for (int d = 0; d < 8; d++) {
-        int newX = lastPlayerX + directions[d][0];
-        int newY = lastPlayerY + directions[d][1];
-        if (newX >= 0 && newX < MAX_SIZE && newY >= 0 && newY < MAX_SIZE && board[newY][newX] == EMPTY) {
-            board[newY][newX] = PLAYER_O;
+        int64_t newX = lastPlayerX + directions[d][0];
+        int64_t newY = lastPlayerY + directions[d][1];
+        if (board.wrapMask) {
+            newX &= board.wrapMask;
+            newY &= board.wrapMask;
+        }
+        Cell cell = last ? last[directions[d][1] * board.paddedStride + directions[d][0]] : getCell(&board, newX, newY);
+        if (cell == EMPTY) {
+            *moveX = newX;
+            *moveY = newY;
             return;
         }
     }
 
-    // В крайнем случае делаем случайный ход
-    int x, y;
-    do {
-        x = rand() % MAX_SIZE;
-        y = rand() % MAX_SIZE;
-    } while (board[y][x] != EMPTY);
+    // На упакованном поле ходим рядом с любым камнем
+    if (randomPackedNeighbor(&board.packed, moveX, moveY)) return;
 
-    board[y][x] = PLAYER_O;
+    // В крайнем случае делаем случайный ход в уже занятой области поля
+    if (!randomEmptyCell(&board, moveX, moveY)) {
+        *moveX = lastPlayerX;
+        *moveY = lastPlayerY;
+        while (getCell(&board, *moveX, *moveY) != EMPTY) (*moveX)++;
+    }
 }
 
 int main(int argc, char* argv[]) {
+    // Вариант игры и правила: tictactoe [вариант] [правила] [hash=МБ] [hugepages];
+    // без окна: tictactoe [вариант] [правила] scan файл..., tictactoe [вариант] bench,
+    // tictactoe [вариант] [правила] [hash=МБ] solve позиция [доказательство] или tictactoe replay доказательство
+    int arg = 1;
+    variant = &variants[0];
+    rules = &ruleSets[0];
+    if (arg < argc && findVariant(argv[arg]))
+        variant = findVariant(argv[arg++]);
+    if (arg < argc && findRuleSet(argv[arg]))
+        rules = findRuleSet(argv[arg++]);
+    if (rules->isForbidden && variant->k != 5) {
+        printf("Rule set %s needs five in a row\n", rules->name);
+        return 1;
+    }
+    // Размер таблицы транспозиций и большие страницы для неё
+    size_t ttMegabytes = TT_DEFAULT_MB;
+    int hugePages = 0;
+    for (; arg < argc; arg++) {
+        if (strncmp(argv[arg], "hash=", 5) == 0 && atoi(argv[arg] + 5) > 0)
+            ttMegabytes = atoi(argv[arg] + 5);
+        else if (strcmp(argv[arg], "hugepages") == 0)
+            hugePages = 1;
+        else
+            break;
+    }
+    if (arg < argc && strcmp(argv[arg], "scan") == 0)
+        return scanPositionFiles(variant->k, argc - arg - 1, argv + arg + 1);
+    if (arg < argc && strcmp(argv[arg], "bench") == 0)
+        return benchEdgeChecks();
+    if (arg + 1 < argc && strcmp(argv[arg], "solve") == 0)
+        return solvePositionFile(argv[arg + 1], arg + 2 < argc ? argv[arg + 2] : NULL, ttMegabytes);
+    if (arg + 1 < argc && strcmp(argv[arg], "replay") == 0)
+        return replayProofFile(argv[arg + 1]);
+    if (arg < argc) {
+        printf("Unknown variant or rule set: %s\n", argv[arg]);
+        return 1;
+    }
+
     SDL_Init(SDL_INIT_VIDEO);
     TTF_Init();
     SDL_Window* window = SDL_CreateWindow("Infinite Tic Tac Toe", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, WINDOW_WIDTH, WINDOW_HEIGHT, SDL_WINDOW_SHOWN);
     SDL_Renderer* renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
 
-    int emptyCells;
-    initBoard(&emptyCells);
+    initBoard(&board, variant->size, variant->torus, variant->k);
+    ttInit(&tt, ttMegabytes, hugePages);
+    vcfInit(&vcf, &board);
 
     int running = 1;
     int gameOver = 0;
@@ -222,11 +3450,13 @@ int main(int argc, char* argv[]) {
     char message[50] = "";
 
     // Функция для проверки состояния игры после хода
-    void checkGameState(int x, int y) {
-        if (checkWin(currentPlayer, x, y)) {
+    // Ничья возможна только на конечном поле: когда все клетки заняты
+    // или когда ни в одном окне из k клеток уже нельзя собрать ряд
+    void checkGameState(int64_t x, int64_t y) {
+        if (checkWin(currentPlayer, x, y, &board.winLine)) {
             snprintf(message, sizeof(message), "Player %c wins!", currentPlayer == PLAYER_X ? 'X' : 'O');
             gameOver = 1;
-        } else if (emptyCells == 0) {
+        } else if (board.size && (board.stones == board.size * board.size || (board.windowStones[0] && board.liveWindows == 0))) {
             snprintf(message, sizeof(message), "It's a draw!");
             gameOver = 1;
         } else {
@@ -241,32 +3471,82 @@ int main(int argc, char* argv[]) {
                 running = 0;
             }
 
-            // Управление камерой с зацикливанием
+            // Управление камерой
             if (event.type == SDL_KEYDOWN) {
                 switch (event.key.keysym.sym) {
-                    case SDLK_w: cameraY = (cameraY - CELL_SIZE + MAX_SIZE * CELL_SIZE) % (MAX_SIZE * CELL_SIZE); break;
-                    case SDLK_s: cameraY = (cameraY + CELL_SIZE) % (MAX_SIZE * CELL_SIZE); break;
-                    case SDLK_a: cameraX = (cameraX - CELL_SIZE + MAX_SIZE * CELL_SIZE) % (MAX_SIZE * CELL_SIZE); break;
-                    case SDLK_d: cameraX = (cameraX + CELL_SIZE) % (MAX_SIZE * CELL_SIZE); break;
+                    case SDLK_w: cameraY -= CELL_SIZE; break;
+                    case SDLK_s: cameraY += CELL_SIZE; break;
+                    case SDLK_a: cameraX -= CELL_SIZE; break;
+                    case SDLK_d: cameraX += CELL_SIZE; break;
+                    case SDLK_F5: savePosition(&board, POSITION_FILE); break;
+                    case SDLK_h: showHint = !showHint; hintKey = ~board.hash; break;
+                    case SDLK_F9:
+                        // Загруженная позиция продолжается ходом игрока, если в ней ещё нет победителя
+                        // Выигрышная линия берётся из файла, а в позициях без неё ищется на поле
+                        if (loadPosition(&board, POSITION_FILE)) {
+                            WinLine lines[64];
+                            int found = board.winLine.length ? 0 : findWinningLines(&board, variant->k, lines, 64);
+                            gameOver = 0;
+                            currentPlayer = PLAYER_X;
+                            message[0] = '\0';
+                            if (board.winLine.length) {
+                                snprintf(message, sizeof(message), "Player %c wins!", board.winLine.player == PLAYER_X ? 'X' : 'O');
+                                gameOver = 1;
+                            }
+                            for (int i = 0; i < found && i < 64 && !gameOver; i++) {
+                                if (!lineWins(&lines[i])) continue;
+                                board.winLine = lines[i];
+                                snprintf(message, sizeof(message), "Player %c wins!", lines[i].player == PLAYER_X ? 'X' : 'O');
+                                gameOver = 1;
+                            }
+                            if (!gameOver && board.windowStones[0] && board.liveWindows == 0) {
+                                snprintf(message, sizeof(message), "It's a draw!");
+                                gameOver = 1;
+                            }
+                        }
+                        break;
+                }
+            }
+
+            // Отмена (Ctrl+Z) и повтор (Ctrl+Y) ходов
+            if (event.type == SDL_KEYDOWN && (event.key.keysym.mod & KMOD_CTRL)) {
+                const MoveRecord* record;
+                if (event.key.keysym.sym == SDLK_z) {
+                    // Отменяем ответ компьютера вместе с ходом игрока
+                    while ((record = unmakeMove(&board)) && record->player != PLAYER_X) {}
+                    gameOver = 0;
+                    currentPlayer = PLAYER_X;
+                    message[0] = '\0';
+                } else if (event.key.keysym.sym == SDLK_y && !gameOver) {
+                    // Повторяем ход игрока и ответ компьютера
+                    while ((record = redoMove(&board))) {
+                        checkGameState(record->x, record->y);
+                        if (gameOver || currentPlayer == PLAYER_X) break;
+                    }
                 }
             }
 
             // Обработка хода игрока
             if (event.type == SDL_MOUSEBUTTONDOWN && !gameOver) {
-                int x = (event.button.x + cameraX) / CELL_SIZE;
-                int y = (event.button.y + cameraY) / CELL_SIZE;
+                int64_t x = floorDiv(event.button.x + cameraX, CELL_SIZE);
+                int64_t y = floorDiv(event.button.y + cameraY, CELL_SIZE);
+                // На торе поле повторяется: клик по любой копии — ход в клетку поля
+                if (board.wrapMask) {
+                    x &= board.wrapMask;
+                    y &= board.wrapMask;
+                }
 
-                // Проверяем, что клетка пуста, и делаем ход
-                if (board[y][x] == EMPTY) {
-                    board[y][x] = currentPlayer;
-                    emptyCells--;
+                // Проверяем, что ход в клетку разрешён (она на поле, пуста и не запрещена правилами), и делаем его
+                if (isLegalMove(&board, currentPlayer, x, y)) {
+                    makeMove(&board, x, y, currentPlayer);
                     checkGameState(x, y);
 
                     // Если игра продолжается и ход у компьютера
                     if (!gameOver && currentPlayer == PLAYER_O) {
-                        aiMove(x, y);  // Передаём последний ход игрока
-                        emptyCells--;
-                        checkGameState(x, y); // Проверяем состояние игры после
+                        int64_t aiX, aiY;
+                        aiMove(x, y, &aiX, &aiY);  // Передаём последний ход игрока
+                        makeMove(&board, aiX, aiY, PLAYER_O);
+                        checkGameState(aiX, aiY); // Проверяем состояние игры после
                     }
                 }
             }
@@ -282,7 +3562,7 @@ int main(int argc, char* argv[]) {
                 if (isClickInsideRect(closeButton, mouseX, mouseY)) {
                     running = 0; // Закрыть игру
                 } else if (isClickInsideRect(retryButton, mouseX, mouseY)) {
-                    initBoard(&emptyCells); // Начать новую игру
+                    initBoard(&board, variant->size, variant->torus, variant->k); // Начать новую игру
                     gameOver = 0;
                     currentPlayer = PLAYER_X; // Сброс хода на игрока X
                     snprintf(message, sizeof(message), "");
@@ -295,6 +3575,14 @@ int main(int argc, char* argv[]) {
         SDL_RenderClear(renderer);
         drawBoard(renderer);
 
+        // Подсказка ищется заново, только когда позиция изменилась
+        if (showHint && !gameOver && board.hash != hintKey) {
+            hintKey = board.hash;
+            startHint(&hint);
+        }
+        if (showHint && !gameOver && __atomic_load_n(&hint.ready, __ATOMIC_ACQUIRE) && hint.found)
+            drawHint(renderer, &hint.line);
+
         // Если игра завершена, отображаем сообщение
         if (gameOver) {
             drawMessageBox(renderer, message);
@@ -304,6 +3592,15 @@ int main(int argc, char* argv[]) {
     }
 
     // Очистка ресурсов SDL
+    ttPrintStats(&tt);
+    cancelHint(&hint);
+    vcfFree(&hint.vcf);
+    vctFree(&hint.vct);
+    freeBoard(&hint.board);
+    ttFree(&tt);
+    vcfFree(&vcf);
+    vctFree(&vct);
+    freeBoard(&board);
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
     TTF_Quit();